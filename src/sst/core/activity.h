@@ -207,6 +207,7 @@ protected:
     // inherit from it need to be serializable.
     void serialize_order(SST::Core::Serialization::serializer& ser) override
     {
+        if ( ser.skip_activity_header() ) return;
         ser& delivery_time;
         ser& priority_order;
         ser& queue_order;
@@ -245,6 +246,15 @@ private:
     static std::mutex              poolMutex;
     static std::vector<PoolInfo_t> memPools;
 
+    /* The calling thread's pools, indexed by size class so that the
+     * lookup in operator new doesn't have to search memPools */
+    static thread_local std::vector<Core::MemPool*> threadPools;
+
+    static inline size_t getSizeClass(std::size_t size) { return (size + sizeof(PoolData_t) - 1) / sizeof(PoolData_t); }
+
+    /* Creates the calling thread's pool for the given size class */
+    static Core::MemPool* createMemPool(size_t size_class);
+
 public:
     /** Allocates memory from a memory pool for a new Activity */
     void* operator new(std::size_t size) noexcept
@@ -254,23 +264,10 @@ public:
          * 2) Alloc item from pool
          * 3) Append PoolID to item, increment pointer
          */
-        Core::MemPool*  pool   = nullptr;
-        size_t          nPools = memPools.size();
-        std::thread::id tid    = std::this_thread::get_id();
-        for ( size_t i = 0; i < nPools; i++ ) {
-            PoolInfo_t& p = memPools[i];
-            if ( p.tid == tid && p.size == size ) {
-                pool = p.pool;
-                break;
-            }
-        }
-        if ( nullptr == pool ) {
-            /* Still can't find it, alloc a new one */
-            pool = new Core::MemPool(size + sizeof(PoolData_t));
-
-            std::lock_guard<std::mutex> lock(poolMutex);
-            memPools.emplace_back(tid, size, pool);
-        }
+        size_t         size_class = getSizeClass(size);
+        Core::MemPool* pool       = nullptr;
+        if ( size_class < threadPools.size() ) pool = threadPools[size_class];
+        if ( nullptr == pool ) pool = createMemPool(size_class);
 
         PoolData_t* ptr = (PoolData_t*)pool->malloc();
         if ( !ptr ) {
@@ -311,22 +308,45 @@ public:
 
     static void getMemPoolUsage(uint64_t& bytes, uint64_t& active_activities)
     {
-        bytes             = 0;
+        uint64_t reserved_bytes;
+        getMemPoolUsage(bytes, reserved_bytes, active_activities);
+    }
+
+    /** Returns the resident and reserved bytes across all memory
+     * pools, along with the number of activities that haven't been
+     * deleted */
+    static void getMemPoolUsage(uint64_t& resident_bytes, uint64_t& reserved_bytes, uint64_t& active_activities)
+    {
+        resident_bytes    = 0;
+        reserved_bytes    = 0;
         active_activities = 0;
         for ( auto&& entry : Activity::memPools ) {
-            bytes += entry.pool->getBytesMemUsed();
+            resident_bytes += entry.pool->getBytesMemUsed();
+            reserved_bytes += entry.pool->getBytesReserved();
             active_activities += entry.pool->getUndeletedEntries();
         }
     }
 
+    /** Returns fully free arenas in the calling thread's memory pools
+     * to the OS.  Returns the number of bytes released. */
+    static uint64_t trimMemPools()
+    {
+        uint64_t released = 0;
+        for ( auto pool : threadPools ) {
+            if ( pool ) released += pool->trim();
+        }
+        return released;
+    }
+
     static void printUndeletedActivities(const std::string& header, Output& out, SimTime_t before = MAX_SIMTIME_T)
     {
         for ( auto&& entry : Activity::memPools ) {
-            const std::list<uint8_t*>& arenas    = entry.pool->getArenas();
-            size_t                     arenaSize = entry.pool->getArenaSize();
-            size_t                     elemSize  = entry.pool->getElementSize();
-            size_t                     nelem     = arenaSize / elemSize;
+            const std::list<uint8_t*>& arenas   = entry.pool->getArenas();
+            size_t                     elemSize = entry.pool->getElementSize();
             for ( auto iter = arenas.begin(); iter != arenas.end(); ++iter ) {
+                // Only look at elements that have been handed out, so
+                // untouched pages don't get faulted in
+                size_t nelem = entry.pool->getArenaElements(*iter);
                 for ( size_t j = 0; j < nelem; j++ ) {
                     PoolData_t* ptr = (PoolData_t*)((*iter) + (elemSize * j));
                     if ( *ptr != nullptr ) {
@@ -114,7 +114,8 @@ BaseComponent::pushValidParams(Params& params, const std::string& type)
 TimeConverter*
 BaseComponent::registerClock(const std::string& freq, Clock::HandlerBase* handler, bool regAll)
 {
-    TimeConverter* tc = Simulation_impl::getSimulation()->registerClock(freq, handler, CLOCKPRIORITY);
+    TimeConverter* tc = Simulation_impl::getSimulation()->registerClock(
+        freq, handler, CLOCKPRIORITY, COMPONENT_ID_MASK(my_info->getID()));
 
     // Check to see if there is a profile tool installed
     auto* tool =
@@ -139,7 +140,8 @@ BaseComponent::registerClock(const std::string& freq, Clock::HandlerBase* handle
 TimeConverter*
 BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, bool regAll)
 {
-    TimeConverter* tc = Simulation_impl::getSimulation()->registerClock(freq, handler, CLOCKPRIORITY);
+    TimeConverter* tc = Simulation_impl::getSimulation()->registerClock(
+        freq, handler, CLOCKPRIORITY, COMPONENT_ID_MASK(my_info->getID()));
 
     // Check to see if there is a profile tool installed
     auto* tool =
@@ -164,7 +166,8 @@ BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handle
 TimeConverter*
 BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll)
 {
-    TimeConverter* tcRet = Simulation_impl::getSimulation()->registerClock(tc, handler, CLOCKPRIORITY);
+    TimeConverter* tcRet = Simulation_impl::getSimulation()->registerClock(
+        tc, handler, CLOCKPRIORITY, COMPONENT_ID_MASK(my_info->getID()));
 
     // Check to see if there is a profile tool installed
     auto* tool =
@@ -189,7 +192,8 @@ BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, boo
 Cycle_t
 BaseComponent::reregisterClock(TimeConverter* freq, Clock::HandlerBase* handler)
 {
-    return Simulation_impl::getSimulation()->reregisterClock(freq, handler, CLOCKPRIORITY);
+    return Simulation_impl::getSimulation()->reregisterClock(
+        freq, handler, CLOCKPRIORITY, COMPONENT_ID_MASK(my_info->getID()));
 }
 
 Cycle_t
@@ -204,6 +208,33 @@ BaseComponent::unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler)
     Simulation_impl::getSimulation()->unregisterClock(tc, handler, CLOCKPRIORITY);
 }
 
+bool
+BaseComponent::suspendClock(TimeConverter* tc, Clock::HandlerBase* handler, Cycle_t wake_cycle)
+{
+    return Simulation_impl::getSimulation()->suspendClock(tc, handler, wake_cycle, CLOCKPRIORITY);
+}
+
+bool
+BaseComponent::suspendClock(TimeConverter* tc, Clock::HandlerBase* handler, const std::string& port, Cycle_t wake_cycle)
+{
+    LinkMap* myLinks = my_info->getLinkMap();
+    Link*    link    = nullptr;
+    if ( nullptr != myLinks ) { link = myLinks->getLink(port); }
+    if ( nullptr == link ) {
+        fatal(CALL_INFO, 1, "suspendClock(): port %s is not connected or has not been configured\n", port.c_str());
+    }
+
+    Clock* clock = Simulation_impl::getSimulation()->getClock(tc, CLOCKPRIORITY);
+    link->addClockWakeup(clock, handler);
+    return clock->suspendHandler(handler, wake_cycle);
+}
+
+bool
+BaseComponent::wakeClock(TimeConverter* tc, Clock::HandlerBase* handler)
+{
+    return Simulation_impl::getSimulation()->wakeClock(tc, handler, CLOCKPRIORITY);
+}
+
 TimeConverter*
 BaseComponent::registerTimeBase(const std::string& base, bool regAll)
 {
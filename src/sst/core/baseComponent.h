@@ -315,6 +315,38 @@ protected:
     /** Returns the next Cycle that the TimeConverter would fire */
     Cycle_t getNextClockCycle(TimeConverter* freq);
 
+    /** Suspends a clock handler instead of having it called on every
+     * cycle.  The handler is next called on cycle wake_cycle of its
+     * clock, unless woken up earlier with wakeClock().  When all the
+     * handlers on a clock are suspended, the clock stops ticking.  Can
+     * be called from within the handler, which should then return
+     * false.
+     * @param tc TimeConverter returned when the clock was registered
+     * @param handler Handler to suspend
+     * @param wake_cycle Cycle to wake up on, or MAX_SIMTIME_T to
+     * sleep until explicitly woken up
+     * @return true if the handler was suspended, false if wake_cycle
+     * is not past the next cycle of the clock
+     */
+    bool suspendClock(TimeConverter* tc, Clock::HandlerBase* handler, Cycle_t wake_cycle);
+
+    /** Suspends a clock handler until an event is delivered on the
+     * named port or until cycle wake_cycle of its clock, whichever
+     * comes first.  The port must have an event handler installed.  A
+     * handler may be woken up early by an event on a port it waited on
+     * during an earlier suspension, so it should recheck its state
+     * when called.
+     * @return true if the handler was suspended
+     */
+    bool suspendClock(
+        TimeConverter* tc, Clock::HandlerBase* handler, const std::string& port, Cycle_t wake_cycle = MAX_SIMTIME_T);
+
+    /** Wakes up a suspended clock handler.  The handler will be called
+     * on the next cycle of its clock.
+     * @return true if the handler was suspended
+     */
+    bool wakeClock(TimeConverter* tc, Clock::HandlerBase* handler);
+
     /** Registers a default time base for the component and optionally
         sets the the component's links to that timebase. Useful for
         components which do not have a clock, but would like a default
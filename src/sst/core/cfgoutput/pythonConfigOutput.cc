@@ -175,6 +175,7 @@ PythonConfigGraphOutput::generateStatGroup(const ConfigGraph* graph, const Confi
     if ( grp.outputFrequency.getValue() != 0 ) {
         fprintf(outputFile, "%s.setFrequency(\"%s\")\n", pyGroupName, grp.outputFrequency.toStringBestSI().c_str());
     }
+    if ( grp.mergeStats ) { fprintf(outputFile, "%s.setMerge(True)\n", pyGroupName); }
     if ( grp.outputID != 0 ) {
         const ConfigStatOutput& out = graph->getStatOutput(grp.outputID);
         fprintf(outputFile, "%s.setOutput(sst.StatisticOutput(\"%s\"", pyGroupName, out.type.c_str());
@@ -14,16 +14,30 @@
 #include "sst/core/clock.h"
 
 #include "sst/core/factory.h"
+#include "sst/core/profile/clockHandlerProfileTool.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/timeConverter.h"
 
+#include <algorithm>
 #include <sys/time.h>
 
 namespace SST {
 
-Clock::Clock(TimeConverter* period, int priority) : Action(), currentCycle(0), period(period), scheduled(false)
+Clock::Clock(TimeConverter* period, int priority) :
+    Action(),
+    currentCycle(0),
+    period(period),
+    scheduled(false),
+    executing(false),
+    numRemoved(0),
+    nextWakeCycle(MAX_SIMTIME_T),
+    wakeup(nullptr),
+    wakeupTime(MAX_SIMTIME_T),
+    profile_tool(nullptr),
+    profile_key(0)
 {
     setPriority(priority);
+    wakeup = new ClockWakeup(this);
 }
 
 Clock::~Clock()
@@ -33,12 +47,27 @@ Clock::~Clock()
         delete *it;
     }
     staticHandlerMap.clear();
+    for ( auto& x : pendingHandlers ) {
+        delete x.first;
+    }
+    pendingHandlers.clear();
+    for ( auto& x : sleepingHandlers ) {
+        delete x.handler;
+    }
+    sleepingHandlers.clear();
+    // A wakeup still in the TimeVortex is deleted along with it
+    if ( wakeupTime == MAX_SIMTIME_T ) delete wakeup;
 }
 
 bool
-Clock::registerHandler(Clock::HandlerBase* handler)
+Clock::registerHandler(Clock::HandlerBase* handler, ComponentId_t group)
 {
-    staticHandlerMap.push_back(handler);
+    // Can't move handlers around in the middle of a tick, so hold on
+    // to it until the tick is done
+    if ( executing )
+        pendingHandlers.emplace_back(handler, group);
+    else
+        insertHandler(handler, group);
     if ( !scheduled ) { schedule(); }
     return 0;
 }
@@ -46,21 +75,252 @@ Clock::registerHandler(Clock::HandlerBase* handler)
 bool
 Clock::unregisterHandler(Clock::HandlerBase* handler, bool& empty)
 {
+    bool found = false;
+    for ( size_t i = 0; i < staticHandlerMap.size(); ++i ) {
+        if ( staticHandlerMap[i] == handler ) {
+            if ( executing ) {
+                // Will get compacted out at the end of the tick
+                staticHandlerMap[i] = nullptr;
+                numRemoved++;
+            }
+            else {
+                removeFromGroup(staticHandlerGroups[i]);
+                staticHandlerMap.erase(staticHandlerMap.begin() + i);
+                staticHandlerGroups.erase(staticHandlerGroups.begin() + i);
+            }
+            found = true;
+            break;
+        }
+    }
 
-    StaticHandlerMap_t::iterator iter = staticHandlerMap.begin();
+    if ( !found ) {
+        for ( auto iter = pendingHandlers.begin(); iter != pendingHandlers.end(); ++iter ) {
+            if ( iter->first == handler ) {
+                pendingHandlers.erase(iter);
+                found = true;
+                break;
+            }
+        }
+    }
 
-    for ( ; iter != staticHandlerMap.end(); iter++ ) {
-        if ( *iter == handler ) {
-            staticHandlerMap.erase(iter);
-            break;
+    if ( !found ) {
+        for ( auto iter = sleepingHandlers.begin(); iter != sleepingHandlers.end(); ++iter ) {
+            if ( iter->handler == handler ) {
+                sleepingHandlers.erase(iter);
+                break;
+            }
         }
     }
 
-    empty = staticHandlerMap.empty();
+    empty = getNumHandlers() == 0;
 
     return 0;
 }
 
+bool
+Clock::suspendHandler(Clock::HandlerBase* handler, Cycle_t wake_cycle)
+{
+    // currentCycle isn't updated while the clock is stopped
+    if ( !scheduled ) currentCycle = Simulation_impl::getSimulation()->getCurrentSimCycle() / period->getFactor();
+
+    // Sleeping until the next tick is the same as not sleeping
+    if ( wake_cycle <= currentCycle + 1 ) {
+        wakeHandler(handler);
+        return false;
+    }
+
+    for ( auto& x : sleepingHandlers ) {
+        if ( x.handler == handler ) {
+            x.wake_cycle = wake_cycle;
+            if ( wake_cycle < nextWakeCycle ) {
+                nextWakeCycle = wake_cycle;
+                // Need an earlier wakeup if the clock is stopped
+                if ( !scheduled && !sleep() ) schedule();
+            }
+            return true;
+        }
+    }
+
+    bool          found = false;
+    ComponentId_t group = UNSET_COMPONENT_ID;
+    for ( size_t i = 0; i < staticHandlerMap.size(); ++i ) {
+        if ( staticHandlerMap[i] == handler ) {
+            group = staticHandlerGroups[i];
+            if ( executing ) {
+                // Will get compacted out at the end of the tick
+                staticHandlerMap[i] = nullptr;
+                numRemoved++;
+            }
+            else {
+                removeFromGroup(group);
+                staticHandlerMap.erase(staticHandlerMap.begin() + i);
+                staticHandlerGroups.erase(staticHandlerGroups.begin() + i);
+            }
+            found = true;
+            break;
+        }
+    }
+
+    if ( !found ) {
+        for ( auto iter = pendingHandlers.begin(); iter != pendingHandlers.end(); ++iter ) {
+            if ( iter->first == handler ) {
+                group = iter->second;
+                pendingHandlers.erase(iter);
+                found = true;
+                break;
+            }
+        }
+    }
+
+    if ( !found ) return false;
+
+    sleepingHandlers.push_back({ handler, group, wake_cycle });
+    if ( wake_cycle < nextWakeCycle ) nextWakeCycle = wake_cycle;
+    return true;
+}
+
+bool
+Clock::wakeHandler(Clock::HandlerBase* handler)
+{
+    for ( auto iter = sleepingHandlers.begin(); iter != sleepingHandlers.end(); ++iter ) {
+        if ( iter->handler == handler ) {
+            if ( executing )
+                pendingHandlers.emplace_back(iter->handler, iter->group);
+            else
+                insertHandler(iter->handler, iter->group);
+            sleepingHandlers.erase(iter);
+            if ( !scheduled ) { schedule(); }
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+Clock::setProfileTool(Profile::ClockHandlerProfileTool* tool)
+{
+    profile_tool = tool;
+    profile_key  = tool->registerClock(period->getFactor(), getPriority());
+}
+
+void
+Clock::insertHandler(Clock::HandlerBase* handler, ComponentId_t group)
+{
+    if ( group != UNSET_COMPONENT_ID ) {
+        size_t& count = groupCounts[group];
+        count++;
+        if ( count > 1 && staticHandlerGroups.back() != group ) {
+            // Put it right after the last handler in the same group
+            auto   iter = std::find(staticHandlerGroups.rbegin(), staticHandlerGroups.rend(), group);
+            size_t pos  = iter.base() - staticHandlerGroups.begin();
+            staticHandlerMap.insert(staticHandlerMap.begin() + pos, handler);
+            staticHandlerGroups.insert(staticHandlerGroups.begin() + pos, group);
+            return;
+        }
+    }
+    staticHandlerMap.push_back(handler);
+    staticHandlerGroups.push_back(group);
+}
+
+void
+Clock::removeFromGroup(ComponentId_t group)
+{
+    if ( group == UNSET_COMPONENT_ID ) return;
+    auto iter = groupCounts.find(group);
+    if ( --iter->second == 0 ) groupCounts.erase(iter);
+}
+
+// Removes the nullptr entries left behind by handlers that were
+// removed during the tick, keeping the remaining handlers in order
+void
+Clock::compactHandlers()
+{
+    size_t out = 0;
+    for ( size_t i = 0; i < staticHandlerMap.size(); ++i ) {
+        if ( staticHandlerMap[i] == nullptr ) {
+            removeFromGroup(staticHandlerGroups[i]);
+            continue;
+        }
+        staticHandlerMap[out]    = staticHandlerMap[i];
+        staticHandlerGroups[out] = staticHandlerGroups[i];
+        out++;
+    }
+    staticHandlerMap.resize(out);
+    staticHandlerGroups.resize(out);
+    numRemoved = 0;
+}
+
+// Moves the handlers that are due to wake up this cycle back to the
+// list of active handlers
+void
+Clock::wakeSleepingHandlers()
+{
+    nextWakeCycle = MAX_SIMTIME_T;
+    size_t out    = 0;
+    for ( size_t i = 0; i < sleepingHandlers.size(); ++i ) {
+        SleepingHandler& x = sleepingHandlers[i];
+        if ( x.wake_cycle <= currentCycle ) {
+            insertHandler(x.handler, x.group);
+            continue;
+        }
+        if ( x.wake_cycle < nextWakeCycle ) nextWakeCycle = x.wake_cycle;
+        sleepingHandlers[out++] = x;
+    }
+    sleepingHandlers.resize(out);
+}
+
+// Called when every handler is suspended.  The clock is taken out of
+// the TimeVortex and the wakeup is inserted for the first timed
+// wakeup, if there is one.  A wakeup that is already in the
+// TimeVortex can't be taken back out, so if it is there for a later
+// time than is needed now, the clock keeps ticking instead and false
+// is returned.
+bool
+Clock::sleep()
+{
+    SimTime_t wake_time = MAX_SIMTIME_T;
+    if ( nextWakeCycle != MAX_SIMTIME_T ) wake_time = nextWakeCycle * period->getFactor();
+
+    if ( wakeupTime == MAX_SIMTIME_T ) {
+        if ( wake_time != MAX_SIMTIME_T ) {
+            Simulation_impl::getSimulation()->insertActivity(wake_time, wakeup);
+            wakeupTime = wake_time;
+        }
+    }
+    else if ( wake_time < wakeupTime ) {
+        return false;
+    }
+
+    // A pending wakeup for an earlier time reschedules itself when it
+    // fires
+    scheduled = false;
+    return true;
+}
+
+void
+Clock::ClockWakeup::execute(void)
+{
+    clock->wakeupTime = MAX_SIMTIME_T;
+
+    // Nothing to do if the clock was restarted by wakeHandler() or
+    // registerHandler(), or its timed handlers were woken or removed
+    if ( clock->scheduled || clock->nextWakeCycle == MAX_SIMTIME_T ) return;
+
+    // The handlers were suspended again for longer since this was
+    // inserted, so move to the new time
+    Simulation_impl* sim       = Simulation_impl::getSimulation();
+    SimTime_t        wake_time = clock->nextWakeCycle * clock->period->getFactor();
+    if ( wake_time > sim->getCurrentSimCycle() ) {
+        sim->insertActivity(wake_time, this);
+        clock->wakeupTime = wake_time;
+        return;
+    }
+
+    clock->currentCycle = clock->nextWakeCycle - 1;
+    clock->scheduled    = true;
+    clock->execute();
+}
+
 Cycle_t
 Clock::getNextCycle()
 {
@@ -73,7 +333,7 @@ Clock::execute(void)
 {
     Simulation_impl* sim = Simulation_impl::getSimulation();
 
-    if ( staticHandlerMap.empty() ) {
+    if ( staticHandlerMap.empty() && sleepingHandlers.empty() ) {
         scheduled = false;
         return;
     }
@@ -82,20 +342,41 @@ Clock::execute(void)
     // currentCycle = period->convertFromCoreTime(sim->getCurrentSimCycle());
     currentCycle++;
 
-    StaticHandlerMap_t::iterator sop_iter;
-    for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end(); ) {
-        Clock::HandlerBase* handler = *sop_iter;
+    if ( currentCycle >= nextWakeCycle ) wakeSleepingHandlers();
+
+    if ( profile_tool ) profile_tool->clockStart(profile_key);
 
+    // Handlers that are done, either by returning true or by being
+    // unregistered during the tick, are set to nullptr and removed in
+    // one pass afterwards
+    executing    = true;
+    size_t count = staticHandlerMap.size();
+    size_t calls = 0;
+    for ( size_t i = 0; i < count; ++i ) {
+        Clock::HandlerBase* handler = staticHandlerMap[i];
+        if ( nullptr == handler ) continue;
 
-        if ( (*handler)(currentCycle) )
-            sop_iter = staticHandlerMap.erase(sop_iter);
-        else
-            ++sop_iter;
+        calls++;
+        if ( (*handler)(currentCycle) && staticHandlerMap[i] != nullptr ) {
+            staticHandlerMap[i] = nullptr;
+            numRemoved++;
+        }
+    }
+    executing = false;
 
-        // (*handler)(currentCycle);
-        // ++sop_iter;
+    if ( numRemoved != 0 ) compactHandlers();
+    if ( !pendingHandlers.empty() ) {
+        for ( auto& x : pendingHandlers ) {
+            insertHandler(x.first, x.second);
+        }
+        pendingHandlers.clear();
     }
 
+    if ( profile_tool ) profile_tool->clockEnd(profile_key, calls);
+
+    // Stop ticking while every handler is suspended
+    if ( staticHandlerMap.empty() && !sleepingHandlers.empty() && sleep() ) return;
+
     next = sim->getCurrentSimCycle() + period->getFactor();
     sim->insertActivity(next, this);
 
@@ -129,7 +410,7 @@ Clock::toString() const
 {
     std::stringstream buf;
     buf << "Clock Activity with period " << period->getFactor() << " to be delivered at " << getDeliveryTime()
-        << " with priority " << getPriority() << " with " << staticHandlerMap.size() << " items on clock list";
+        << " with priority " << getPriority() << " with " << getNumHandlers() << " items on clock list";
     return buf.str();
 }
 
@@ -16,6 +16,7 @@
 #include "sst/core/ssthandler.h"
 
 #include <cinttypes>
+#include <unordered_map>
 #include <vector>
 
 #define _CLE_DBG(fmt, args...) __DBG(DBG_CLOCK, Clock, fmt, ##args)
@@ -24,10 +25,25 @@ namespace SST {
 
 class TimeConverter;
 
+namespace Profile {
+class ClockHandlerProfileTool;
+}
+
 /**
  * A Clock class.
  *
- * Calls callback functions (handlers) on a specified period
+ * Calls callback functions (handlers) on a specified period.
+ * Handlers are kept in a contiguous array and are called in the order
+ * they were registered.  Handlers registered with a group (only done
+ * with --group-clock-handlers) are instead stored right after the
+ * other handlers of their group, still in registration order within
+ * the group.  Handlers removed during a tick are compacted out in a
+ * single pass after all handlers have been called.
+ *
+ * Handlers can also be suspended until a given cycle or until they are
+ * explicitly woken up.  Suspended handlers are not called and, when
+ * every handler on the clock is suspended, the clock stops ticking and
+ * is not put back into the TimeVortex until a handler wakes up.
  */
 class Clock : public Action
 {
@@ -76,27 +92,112 @@ public:
     /** Return the time of the next clock tick */
     Cycle_t getNextCycle();
 
-    /** Add a handler to be called on this clock's tick */
-    bool registerHandler(Clock::HandlerBase* handler);
+    /** Add a handler to be called on this clock's tick.  Handlers
+     * with the same group (normally the id of the component that
+     * owns them) are stored next to each other.  Handlers added
+     * while the clock is executing are first called on the next
+     * tick. */
+    bool registerHandler(Clock::HandlerBase* handler, ComponentId_t group = UNSET_COMPONENT_ID);
     /** Remove a handler from the list of handlers to be called on the clock tick */
     bool unregisterHandler(Clock::HandlerBase* handler, bool& empty);
 
+    /** Stop calling a handler until the given cycle of this clock.
+     * The handler will next be called on cycle wake_cycle, unless it
+     * is woken up earlier by wakeHandler().  Use MAX_SIMTIME_T to
+     * suspend the handler until it is explicitly woken up.  Can be
+     * called from within the handler itself.
+     * @return true if the handler was found and suspended */
+    bool suspendHandler(Clock::HandlerBase* handler, Cycle_t wake_cycle);
+    /** Wake up a suspended handler.  The handler will be called on the
+     * next tick of the clock.
+     * @return true if the handler was suspended */
+    bool wakeHandler(Clock::HandlerBase* handler);
+
+    /** Return the number of handlers registered on this clock, including suspended handlers */
+    size_t getNumHandlers() const
+    {
+        return staticHandlerMap.size() - numRemoved + pendingHandlers.size() + sleepingHandlers.size();
+    }
+    /** Return the number of suspended handlers on this clock */
+    size_t getNumSleepingHandlers() const { return sleepingHandlers.size(); }
+
+    /** Attach a profile tool to collect statistics for this clock */
+    void setProfileTool(Profile::ClockHandlerProfileTool* tool);
+
     std::string toString() const override;
 
 private:
     /*     typedef std::list<Clock::HandlerBase*> HandlerMap_t; */
     typedef std::vector<Clock::HandlerBase*> StaticHandlerMap_t;
 
+    /**
+     * Action used to restart the clock when all its handlers are
+     * suspended.  Each clock has one, which is in the TimeVortex at
+     * most once.  When it fires it checks what the clock needs at that
+     * point: it is ignored if the clock was already restarted, and
+     * moves itself to the new wakeup time if that is later.
+     */
+    class ClockWakeup : public Action
+    {
+    public:
+        explicit ClockWakeup(Clock* clock) : Action(), clock(clock) { setPriority(clock->getPriority()); }
+
+        void execute(void) override;
+
+    private:
+        Clock* clock;
+
+        NotSerializable(SST::Clock::ClockWakeup)
+    };
+
+    struct SleepingHandler
+    {
+        Clock::HandlerBase* handler;
+        ComponentId_t       group;
+        Cycle_t             wake_cycle;
+    };
+
     Clock() {}
 
     void execute(void) override;
 
+    void insertHandler(Clock::HandlerBase* handler, ComponentId_t group);
+    void removeFromGroup(ComponentId_t group);
+    void compactHandlers();
+    void wakeSleepingHandlers();
+    bool sleep();
+
     Cycle_t            currentCycle;
     TimeConverter*     period;
     StaticHandlerMap_t staticHandlerMap;
     SimTime_t          next;
     bool               scheduled;
 
+    // Group of each entry in staticHandlerMap, kept separately so the
+    // handler array stays dense
+    std::vector<ComponentId_t>                staticHandlerGroups;
+    std::unordered_map<ComponentId_t, size_t> groupCounts;
+
+    // Handlers removed during the current tick are set to nullptr and
+    // compacted out after the tick
+    bool   executing;
+    size_t numRemoved;
+
+    // Handlers registered during the current tick, along with their
+    // groups
+    std::vector<std::pair<Clock::HandlerBase*, ComponentId_t>> pendingHandlers;
+
+    // Suspended handlers and the earliest cycle one of them needs to
+    // be woken up.  wakeupTime is the core time the wakeup is in the
+    // TimeVortex for, or MAX_SIMTIME_T if it isn't in there.
+    std::vector<SleepingHandler> sleepingHandlers;
+    Cycle_t                      nextWakeCycle;
+    ClockWakeup*                 wakeup;
+    SimTime_t                    wakeupTime;
+
+    Profile::ClockHandlerProfileTool* profile_tool;
+    uintptr_t                         profile_key;
+
     NotSerializable(SST::Clock)
 };
 
@@ -94,7 +94,7 @@ ComponentInfo::ComponentInfo(
     statConfigs(&ccomp->statistics),
     enabledStatNames(&ccomp->enabledStatNames),
     enabledAllStats(ccomp->enabledAllStats),
-    allStatConfig(&ccomp->allStatConfig),
+    allStatConfig(ccomp->allStatConfig),
     statLoadLevel(ccomp->statLoadLevel),
     coordinates(ccomp->coords),
     subIDIndex(1),
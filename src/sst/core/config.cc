@@ -25,6 +25,7 @@ DISABLE_WARN_MISSING_OVERRIDE
 REENABLE_WARNING
 #endif
 
+#include <cctype>
 #include <cstdlib>
 #include <errno.h>
 #include <getopt.h>
@@ -344,9 +345,14 @@ public:
             cfg.parallel_load_mode_multi_ = false;
         else if ( arg_lower == "multi" )
             cfg.parallel_load_mode_multi_ = true;
+        else if ( arg_lower == "distributed" ) {
+            cfg.parallel_load_mode_multi_       = false;
+            cfg.parallel_load_mode_distributed_ = true;
+        }
         else {
             fprintf(
-                stderr, "Invalid option '%s' passed to --parallel-load.  Valid options are SINGLE and MULTI.\n",
+                stderr,
+                "Invalid option '%s' passed to --parallel-load.  Valid options are SINGLE, MULTI and DISTRIBUTED.\n",
                 arg.c_str());
             return false;
         }
@@ -363,6 +369,23 @@ public:
         cfg.parallel_load_ = true;
         return true;
     }
+
+    bool setDistributedBlockSize(const std::string& arg)
+    {
+        try {
+            unsigned long val = stoul(arg);
+            if ( val == 0 ) {
+                fprintf(stderr, "Option --distributed-block-size must be greater than 0\n");
+                return false;
+            }
+            cfg.distributed_block_size_ = val;
+            return true;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --distributed-block-size\n", arg.c_str());
+            return false;
+        }
+    }
 #endif
 
     // Advanced options
@@ -397,6 +420,99 @@ public:
         return success;
     }
 
+    // rank sync
+    bool setRankSync(const std::string& arg)
+    {
+        if ( arg != "auto" && arg != "serial" && arg != "parallel" && arg != "persistent" ) {
+            fprintf(stderr, "Unknown option for --rank-sync: %s\n", arg.c_str());
+            return false;
+        }
+        cfg.rank_sync_ = arg;
+        return true;
+    }
+
+    // thread sync
+    bool setThreadSync(const std::string& arg)
+    {
+        if ( arg != "simple" && arg != "spsc" ) {
+            fprintf(stderr, "Unknown option for --thread-sync: %s\n", arg.c_str());
+            return false;
+        }
+        cfg.thread_sync_ = arg;
+        return true;
+    }
+
+    // adaptive lookahead
+    bool setAdaptiveLookahead()
+    {
+        cfg.adaptive_lookahead_ = true;
+        return true;
+    }
+
+    bool setAdaptiveLookaheadArg(const std::string& arg)
+    {
+        bool success            = false;
+        cfg.adaptive_lookahead_ = parseBoolean(arg, success, "adaptive-lookahead");
+        return success;
+    }
+
+    // rank sync compression
+#ifdef HAVE_LIBZ
+    bool setRankSyncCompression(const std::string& arg)
+    {
+        try {
+            unsigned long val          = stoul(arg);
+            cfg.rank_sync_compression_ = val;
+            return true;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --rank-sync-compression\n", arg.c_str());
+            return false;
+        }
+    }
+#endif
+
+    // asynchronous statistic output
+    bool setAsyncStatOutput()
+    {
+        cfg.async_stat_output_ = true;
+        return true;
+    }
+
+    bool setAsyncStatOutputArg(const std::string& arg)
+    {
+        bool success           = false;
+        cfg.async_stat_output_ = parseBoolean(arg, success, "async-stat-output");
+        return success;
+    }
+
+    bool setAsyncStatOutputQueue(const std::string& arg)
+    {
+        try {
+            unsigned long val            = stoul(arg);
+            cfg.async_stat_output_queue_ = val;
+            return true;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --async-stat-output-queue\n", arg.c_str());
+            return false;
+        }
+    }
+
+    // clock handler grouping
+    bool setGroupClockHandlers()
+    {
+        cfg.group_clock_handlers_ = true;
+        return true;
+    }
+
+    bool setGroupClockHandlersArg(const std::string& arg)
+    {
+        bool success              = false;
+        cfg.group_clock_handlers_ = parseBoolean(arg, success, "group-clock-handlers");
+        return success;
+    }
+
     // debug file
     bool setDebugFile(const std::string& arg)
     {
@@ -433,6 +549,12 @@ public:
         return true;
     }
 
+    bool setPartitionerProfile(const std::string& arg)
+    {
+        cfg.partitioner_profile_ = arg;
+        return true;
+    }
+
 
     // Advanced options - debug
 
@@ -460,6 +582,39 @@ public:
         cfg.event_dump_file_ = arg;
         return true;
     }
+
+    // memory pool huge pages
+    bool setMemPoolHugePages(const std::string& arg)
+    {
+        if ( arg != "none" && arg != "transparent" && arg != "explicit" ) {
+            fprintf(stderr, "Unknown option for --mempool-huge-pages: %s\n", arg.c_str());
+            return false;
+        }
+        cfg.mempool_huge_pages_ = arg;
+        return true;
+    }
+
+    // memory pool trim period
+    bool setMemPoolTrimPeriod(const std::string& arg)
+    {
+        // The units are checked when the TimeLord converts the period,
+        // but that can only fatal, so check the number here
+        const char* str = arg.c_str();
+        char*       end = nullptr;
+        double      val = strtod(str, &end);
+        std::string units(end);
+        units.erase(0, units.find_first_not_of(" \t"));
+        if ( end == str || !(val > 0.0) || units.empty() || !isalpha(units[0]) ) {
+            fprintf(
+                stderr,
+                "Invalid period '%s' for option --mempool-trim-period.  Expected a positive time or frequency, "
+                "such as 10ms\n",
+                arg.c_str());
+            return false;
+        }
+        cfg.mempool_trim_period_ = arg;
+        return true;
+    }
 #endif
 
     // rank sequentional startup
@@ -561,16 +716,28 @@ Config::print()
     std::cout << "output_partition = " << output_partition_ << std::endl;
     std::cout << "timeBase = " << timeBase_ << std::endl;
     std::cout << "parallel_load = " << parallel_load_ << std::endl;
+    std::cout << "parallel_load_mode_distributed = " << parallel_load_mode_distributed_ << std::endl;
+    std::cout << "distributed_block_size = " << distributed_block_size_ << std::endl;
     std::cout << "timeVortex = " << timeVortex_ << std::endl;
     std::cout << "interthread_links = " << interthread_links_ << std::endl;
+    std::cout << "rank_sync = " << rank_sync_ << std::endl;
+    std::cout << "thread_sync = " << thread_sync_ << std::endl;
+    std::cout << "adaptive_lookahead = " << adaptive_lookahead_ << std::endl;
+    std::cout << "rank_sync_compression = " << rank_sync_compression_ << std::endl;
+    std::cout << "async_stat_output = " << async_stat_output_ << std::endl;
+    std::cout << "async_stat_output_queue = " << async_stat_output_queue_ << std::endl;
+    std::cout << "group_clock_handlers = " << group_clock_handlers_ << std::endl;
     std::cout << "debugFile = " << debugFile_ << std::endl;
     std::cout << "libpath = " << libpath_ << std::endl;
     std::cout << "addLlibPath = " << addLibPath_ << std::endl;
     std::cout << "enabled_profiling = " << enabled_profiling_ << std::endl;
     std::cout << "profiling_output = " << profiling_output_ << std::endl;
+    std::cout << "partitioner_profile = " << partitioner_profile_ << std::endl;
     std::cout << "runMode = " << runMode_ << std::endl;
 #ifdef USE_MEMPOOL
     std::cout << "event_dump_file = " << event_dump_file_ << std::endl;
+    std::cout << "mempool_huge_pages = " << mempool_huge_pages_ << std::endl;
+    std::cout << "mempool_trim_period = " << mempool_trim_period_ << std::endl;
 #endif
     std::cout << "rank_seq_startup_ " << rank_seq_startup_ << std::endl;
     std::cout << "print_env" << print_env_ << std::endl;
@@ -617,23 +784,37 @@ Config::Config(RankInfo rank_info) : Config()
     output_partition_         = false;
 
     // Advance Options
-    timeBase_                 = "1 ps";
-    parallel_load_            = false;
-    parallel_load_mode_multi_ = true;
-    timeVortex_               = "sst.timevortex.priority_queue";
-    interthread_links_        = false;
-    debugFile_                = "/dev/null";
-    libpath_                  = SST_INSTALL_PREFIX "/lib/sst";
-    addLibPath_               = "";
+    timeBase_                       = "1 ps";
+    parallel_load_                  = false;
+    parallel_load_mode_multi_       = true;
+    parallel_load_mode_distributed_ = false;
+    distributed_block_size_         = 1024;
+    timeVortex_                     = "sst.timevortex.priority_queue";
+    interthread_links_              = false;
+    rank_sync_                      = "auto";
+    thread_sync_                    = "simple";
+    adaptive_lookahead_             = false;
+    rank_sync_compression_          = 0;
+    async_stat_output_              = false;
+    async_stat_output_queue_        = 16 * 1024 * 1024;
+    group_clock_handlers_           = false;
+    debugFile_                      = "/dev/null";
+    libpath_                        = SST_INSTALL_PREFIX "/lib/sst";
+    addLibPath_                     = "";
 
     // Advance Options - Profiling
-    enabled_profiling_ = "";
-    profiling_output_  = "stdout";
+    enabled_profiling_   = "";
+    profiling_output_    = "stdout";
+    partitioner_profile_ = "";
 
     // Advanced Options - Debug
     runMode_ = Simulation::BOTH;
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     event_dump_file_ = "";
+#endif
+#ifdef USE_MEMPOOL
+    mempool_huge_pages_  = "none";
+    mempool_trim_period_ = "";
 #endif
     rank_seq_startup_ = false;
 
@@ -885,10 +1066,17 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_ARG_OPTVAL(
         "parallel-load", 0, "MODE",
         "Enable parallel loading of configuration. This option is ignored for single rank jobs.  Optional mode "
-        "parameters are SINGLE and MULTI (default).  If SINGLE is specified, the same file will be passed to all MPI "
-        "ranks.  If MULTI is specified, each MPI rank is required to have it's own file to load. Note, not all input "
-        "formats support both types of file loading.",
+        "parameters are SINGLE, MULTI (default) and DISTRIBUTED.  If SINGLE is specified, the same file will be passed "
+        "to all MPI ranks.  If MULTI is specified, each MPI rank is required to have it's own file to load. If "
+        "DISTRIBUTED is specified, every rank runs the same python file, but only builds the components it owns, "
+        "assigned to ranks and threads in blocks of consecutive components (see --distributed-block-size).  Note, not "
+        "all input formats support all types of file loading.",
         &ConfigHelper::enableParallelLoad, &ConfigHelper::enableParallelLoadMode, false),
+    DEF_ARG(
+        "distributed-block-size", 0, "COUNT",
+        "Number of consecutively created components assigned to each rank and thread in turn by "
+        "--parallel-load=DISTRIBUTED (default: 1024).  Components connected by no-cut links are not kept together.",
+        &ConfigHelper::setDistributedBlockSize, false),
 #endif
     DEF_ARG(
         "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>", &ConfigHelper::setTimeVortex,
@@ -896,6 +1084,47 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_FLAG_OPTVAL(
         "interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used <false>",
         &ConfigHelper::setInterThreadLinks, &ConfigHelper::setInterThreadLinksArg, true),
+    DEF_ARG(
+        "rank-sync", 0, "MODE",
+        "Select how events are exchanged between MPI ranks: auto (default), serial, parallel or persistent.  "
+        "persistent uses persistent MPI requests and double buffered send queues.  serial and persistent only apply "
+        "to runs with one thread per rank, parallel is always used with multiple threads.",
+        &ConfigHelper::setRankSync, true),
+    DEF_ARG(
+        "thread-sync", 0, "MODE",
+        "Select how events are exchanged between threads in a rank: simple (default) or spsc.  spsc uses a "
+        "lock-free queue per pair of threads that is drained while threads wait at the sync.  Ignored when "
+        "--interthread-links is enabled.",
+        &ConfigHelper::setThreadSync, true),
+    DEF_FLAG_OPTVAL(
+        "adaptive-lookahead", 0,
+        "Size each rank sync window from the earliest time any rank could send an event to another rank, based on "
+        "its next activity and the latencies of its own cut links, instead of the minimum cut link latency "
+        "<false>",
+        &ConfigHelper::setAdaptiveLookahead, &ConfigHelper::setAdaptiveLookaheadArg, true),
+#ifdef HAVE_LIBZ
+    DEF_ARG(
+        "rank-sync-compression", 0, "BYTES",
+        "Compress the data sent to each rank at a sync with zlib when it is larger than BYTES.  0 (default) disables "
+        "compression.",
+        &ConfigHelper::setRankSyncCompression, true),
+#endif
+    DEF_FLAG_OPTVAL(
+        "async-stat-output", 0,
+        "Write statistic output from a separate thread.  Statistic values are buffered in memory when they are "
+        "output and formatted and written to the file later <false>",
+        &ConfigHelper::setAsyncStatOutput, &ConfigHelper::setAsyncStatOutputArg, true),
+    DEF_ARG(
+        "async-stat-output-queue", 0, "BYTES",
+        "Maximum bytes of buffered statistic output waiting to be written when using --async-stat-output.  The "
+        "simulation waits for the writer when the limit is reached (default: 16777216)",
+        &ConfigHelper::setAsyncStatOutputQueue, true),
+    DEF_FLAG_OPTVAL(
+        "group-clock-handlers", 0,
+        "Call the clock handlers of each component one after another on each clock, instead of in the order they "
+        "were registered.  This keeps each component's state in cache across its handlers, but changes the order "
+        "handlers of different components are called in <false>",
+        &ConfigHelper::setGroupClockHandlers, &ConfigHelper::setGroupClockHandlersArg, true),
     DEF_ARG("debug-file", 0, "FILE", "File where debug output will go", &ConfigHelper::setDebugFile, true),
     DEF_ARG("lib-path", 0, "LIBPATH", "Component library path (overwrites default)", &ConfigHelper::setLibPath, true),
     DEF_ARG(
@@ -911,6 +1140,12 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_ARG(
         "profiling-output", 0, "FILE", "Set output location for profiling data [stdout (default) or a filename]",
         &ConfigHelper::setProfilingOutput, true),
+    DEF_ARG(
+        "partitioner-profile", 0, "FILE",
+        "Set partitioning weights from the profiling output of an earlier run.  Handler times (or counts) become "
+        "component weights and event counts on tracked ports become link weights.  Output written per rank is read "
+        "from all of its files.",
+        &ConfigHelper::setPartitionerProfile, true),
 
     /* Advanced Features - Debug */
     DEF_SECTION_HEADING("Advanced Options - Debug"),
@@ -921,6 +1156,15 @@ static const struct sstLongOpts_s sstOptions[] = {
         "file to write information about all undeleted events at the end of simulation (STDOUT and STDERR can be used "
         "to output to console)",
         &ConfigHelper::setWriteUndeleted, true),
+    DEF_ARG(
+        "mempool-huge-pages", 0, "MODE",
+        "Set the kind of pages backing the memory pools [ none (default) | transparent | explicit ].  explicit uses "
+        "reserved huge pages and falls back to transparent if there are none.",
+        &ConfigHelper::setMemPoolHugePages, true),
+    DEF_ARG(
+        "mempool-trim-period", 0, "PERIOD",
+        "Set time between returning fully free memory pool arenas to the OS (default: never)",
+        &ConfigHelper::setMemPoolTrimPeriod, true),
 #endif
     DEF_FLAG(
         "force-rank-seq-startup", 0,
@@ -219,6 +219,20 @@ public:
     */
     bool parallel_load_mode_multi() const { return parallel_load_mode_multi_; }
 
+    /**
+       If graph construction will be done in parallel, each rank will
+       run the same model file but only build the components it owns
+       if true.  Components are assigned to ranks and threads in
+       blocks of consecutive component ids.
+    */
+    bool parallel_load_mode_distributed() const { return parallel_load_mode_distributed_; }
+
+    /**
+       Number of consecutive component ids in each block assigned to a
+       rank and thread by a distributed build
+    */
+    uint64_t distributed_block_size() const { return distributed_block_size_; }
+
     /**
        TimeVortex implementation to use
     */
@@ -229,6 +243,45 @@ public:
     */
     bool interthread_links() const { return interthread_links_; }
 
+    /**
+       How events are exchanged between ranks (auto, serial, parallel
+       or persistent)
+    */
+    const std::string& rank_sync() const { return rank_sync_; }
+
+    /**
+       How events are exchanged between threads (simple or spsc)
+    */
+    const std::string& thread_sync() const { return thread_sync_; }
+
+    /**
+       Compute the rank sync window from each rank's earliest possible
+       cross rank send instead of the minimum partition latency
+    */
+    bool adaptive_lookahead() const { return adaptive_lookahead_; }
+
+    /**
+       Rank sync data larger than this many bytes is compressed before
+       it is sent.  0 means never compress.
+    */
+    uint64_t rank_sync_compression() const { return rank_sync_compression_; }
+
+    /**
+       Write statistic output from a separate thread
+    */
+    bool async_stat_output() const { return async_stat_output_; }
+
+    /**
+       Maximum bytes of statistic output buffered for the writer thread
+    */
+    uint64_t async_stat_output_queue() const { return async_stat_output_queue_; }
+
+    /**
+       Store the clock handlers of each component next to each other
+       on their clock, instead of in registration order
+    */
+    bool group_clock_handlers() const { return group_clock_handlers_; }
+
     /**
        File to which core debug information should be written
     */
@@ -258,6 +311,11 @@ public:
      */
     const std::string& profilingOutput() const { return profiling_output_; }
 
+    /**
+       Profiling output of an earlier run to take partitioning weights from
+     */
+    const std::string& partitionerProfile() const { return partitioner_profile_; }
+
     // Advanced options - Debug
 
     /**
@@ -274,6 +332,18 @@ public:
        of the simulation.
     */
     const std::string& event_dump_file() const { return event_dump_file_; }
+
+    /**
+       Kind of pages to back memory pool arenas with (none,
+       transparent or explicit)
+    */
+    const std::string& mempool_huge_pages() const { return mempool_huge_pages_; }
+
+    /**
+       Simulation period at which fully free memory pool arenas are
+       returned to the OS (empty string means never)
+    */
+    const std::string& mempool_trim_period() const { return mempool_trim_period_; }
 #endif
 
     /**
@@ -332,14 +402,28 @@ public:
         ser& timeBase_;
         ser& parallel_load_;
         ser& parallel_load_mode_multi_;
+        ser& parallel_load_mode_distributed_;
+        ser& distributed_block_size_;
         ser& timeVortex_;
         ser& interthread_links_;
+        ser& rank_sync_;
+        ser& thread_sync_;
+        ser& adaptive_lookahead_;
+        ser& rank_sync_compression_;
+        ser& async_stat_output_;
+        ser& async_stat_output_queue_;
+        ser& group_clock_handlers_;
         ser& debugFile_;
         ser& libpath_;
         ser& addLibPath_;
         ser& enabled_profiling_;
         ser& profiling_output_;
+        ser& partitioner_profile_;
         ser& runMode_;
+#ifdef USE_MEMPOOL
+        ser& mempool_huge_pages_;
+        ser& mempool_trim_period_;
+#endif
 
         ser& print_env_;
         ser& enable_sig_handling_;
@@ -400,23 +484,35 @@ private:
     bool        output_partition_;         /*!< Output paritition info when writing config output */
 
     // Advanced options
-    std::string timeBase_;                 /*!< Timebase of simulation */
-    bool        parallel_load_;            /*!< Load simulation graph in parallel */
-    bool        parallel_load_mode_multi_; /*!< If true, load using multiple files */
-    std::string timeVortex_;               /*!< TimeVortex implementation to use */
-    bool        interthread_links_;        /*!< Use interthread links */
-    std::string debugFile_;                /*!< File to which debug information should be written */
+    std::string timeBase_;                       /*!< Timebase of simulation */
+    bool        parallel_load_;                  /*!< Load simulation graph in parallel */
+    bool        parallel_load_mode_multi_;       /*!< If true, load using multiple files */
+    bool        parallel_load_mode_distributed_; /*!< If true, each rank builds only the components it owns */
+    uint64_t    distributed_block_size_;         /*!< Component ids per block in a distributed build */
+    std::string timeVortex_;                     /*!< TimeVortex implementation to use */
+    bool        interthread_links_;              /*!< Use interthread links */
+    std::string rank_sync_;                      /*!< RankSync implementation to use */
+    std::string thread_sync_;                    /*!< ThreadSync implementation to use */
+    bool        adaptive_lookahead_;             /*!< Size rank sync windows from per rank lookahead */
+    uint64_t    rank_sync_compression_;          /*!< Compress rank sync data larger than this */
+    bool        async_stat_output_;              /*!< Write statistic output from a separate thread */
+    uint64_t    async_stat_output_queue_;        /*!< Max bytes of statistic output waiting to be written */
+    bool        group_clock_handlers_;           /*!< Group clock handlers by component */
+    std::string debugFile_;                      /*!< File to which debug information should be written */
     std::string libpath_;
     std::string addLibPath_;
 
     // Advanced options - profiling
-    std::string enabled_profiling_; /*!< Enabled default profiling points */
-    std::string profiling_output_;  /*!< Location to write profiling data */
+    std::string enabled_profiling_;   /*!< Enabled default profiling points */
+    std::string profiling_output_;    /*!< Location to write profiling data */
+    std::string partitioner_profile_; /*!< Profiling data to take partitioning weights from */
 
     // Advanced options - debug
     Simulation::Mode_t runMode_; /*!< Run Mode (Init, Both, Run-only) */
 #ifdef USE_MEMPOOL
-    std::string event_dump_file_; /*!< File to dump undeleted events to */
+    std::string event_dump_file_;     /*!< File to dump undeleted events to */
+    std::string mempool_huge_pages_;  /*!< Kind of pages to use for memory pools */
+    std::string mempool_trim_period_; /*!< How often to return free memory pool arenas to the OS */
 #endif
     bool rank_seq_startup_; /*!< Run simulation initialization phases one rank at a time */
 
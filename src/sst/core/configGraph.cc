@@ -67,6 +67,14 @@ checkForValidLinkName(const std::string& name)
         bad_link_name_count++;
     }
 }
+
+// Outputs that write collectively need every rank to take part in
+// each group, including ranks with none of its components
+bool
+isCollectiveStatGroup(const SST::ConfigStatGroup& group, const std::vector<SST::ConfigStatOutput>& outputs)
+{
+    return group.outputID < outputs.size() && outputs[group.outputID].params.find<bool>("collective", false);
+}
 } // anonymous namespace
 
 
@@ -142,6 +150,13 @@ ConfigStatGroup::setFrequency(const std::string& freq)
     return false;
 }
 
+bool
+ConfigStatGroup::setMerge(bool merge)
+{
+    mergeStats = merge;
+    return true;
+}
+
 std::pair<bool, std::string>
 ConfigStatGroup::verifyStatsAndComponents(const ConfigGraph* graph)
 {
@@ -186,7 +201,7 @@ ConfigComponent::print(std::ostream& os) const
     os << "  statLoadLevel = " << (uint32_t)statLoadLevel << std::endl;
     os << "  enabledAllStats = " << enabledAllStats << std::endl;
     os << "    Params:" << std::endl;
-    allStatConfig.params.print_all_params(os, "      ");
+    if ( allStatConfig ) allStatConfig->params.print_all_params(os, "      ");
     os << "  Statistics:" << std::endl;
     for ( auto& pair : enabledStatNames ) {
         os << "    " << pair.first << std::endl;
@@ -215,7 +230,7 @@ ConfigComponent::cloneWithoutLinks(ConfigGraph* new_graph) const
     ret->statistics       = statistics;
     ret->enabledStatNames = enabledStatNames;
     ret->enabledAllStats  = enabledAllStats;
-    ret->allStatConfig    = allStatConfig;
+    ret->allStatConfig    = allStatConfig ? new ConfigStatistic(*allStatConfig) : nullptr;
     ret->coords           = coords;
     ret->nextSubID        = nextSubID;
     ret->graph            = new_graph;
@@ -278,6 +293,13 @@ ConfigComponent::getNextStatisticID()
     return STATISTIC_ID_CREATE(id, statId);
 }
 
+ConfigStatistic*
+ConfigComponent::getAllStatConfig()
+{
+    if ( nullptr == allStatConfig ) allStatConfig = new ConfigStatistic(STATALL_ID);
+    return allStatConfig;
+}
+
 ConfigComponent*
 ConfigComponent::getParent() const
 {
@@ -335,6 +357,14 @@ ConfigComponent::addParameter(const std::string& key, const std::string& value,
     params.enableVerify(bk);
 }
 
+void
+ConfigComponent::addParameters(const std::map<std::string, std::string>& new_params)
+{
+    // Models usually give the same set to many components, so it is
+    // stored as a shared set when possible
+    params.insertShared(new_params);
+}
+
 ConfigStatistic*
 ConfigComponent::createStatistic()
 {
@@ -367,10 +397,9 @@ ConfigComponent::enableStatistic(const std::string& statisticName, const SST::Pa
         // The ConfigStatistic object for STATALLFLAG is not an entry of the statistics
         // It has its own ConfigStatistic as a member variable of ConfigComponent which must be used
         // in case of enabledAllStats == true.
-        enabledAllStats  = true;
-        allStatConfig.id = STATALL_ID;
-        allStatConfig.params.insert(params);
-        return &allStatConfig;
+        enabledAllStats = true;
+        getAllStatConfig()->params.insert(params);
+        return allStatConfig;
     }
     else {
         // this is a valid statistic
@@ -443,7 +472,7 @@ ConfigComponent::addStatisticParameter(
     }
 
     ConfigStatistic* cs = nullptr;
-    if ( statisticName == STATALLFLAG ) { cs = &allStatConfig; }
+    if ( statisticName == STATALLFLAG ) { cs = getAllStatConfig(); }
     else {
         cs = findStatistic(statisticName);
     }
@@ -464,8 +493,7 @@ ConfigComponent::setStatisticParameters(const std::string& statisticName, const
     }
 
     if ( statisticName == STATALLFLAG ) {
-        allStatConfig.params.insert(params);
-        ;
+        getAllStatConfig()->params.insert(params);
     }
     else {
         findStatistic(statisticName)->params.insert(params);
@@ -695,17 +723,52 @@ ConfigGraph::checkRanks(RankInfo ranks)
 void
 ConfigGraph::postCreationCleanup()
 {
+    // Add the remote components from a distributed build.  They are
+    // merged in id order, since inserting into the middle of a
+    // SparseVectorMap is slow.
+    remote_link_ends.clear();
+    if ( !remote_comps.empty() && !comps.contains(remote_comps.begin()->first) ) {
+        ConfigComponentMap_t merged;
+        auto                 remote = remote_comps.begin();
+        for ( ConfigComponent* comp : comps ) {
+            while ( remote != remote_comps.end() && remote->first < comp->id ) {
+                merged.insert(remote->second);
+                ++remote;
+            }
+            merged.insert(comp);
+        }
+        for ( ; remote != remote_comps.end(); ++remote ) {
+            merged.insert(remote->second);
+        }
+        comps = std::move(merged);
+    }
+
     TimeLord* timeLord = Simulation_impl::getTimeLord();
     for ( ConfigLink* link : getLinkMap() ) {
         link->updateLatencies(timeLord);
     }
 
-    LinkId_t count = 1;
+    // Links are ordered by name, so the order does not depend on how
+    // the links were created
+    std::vector<std::pair<const std::string*, LinkId_t>> sorted_names;
+    sorted_names.reserve(link_names.size());
     for ( auto& it : link_names ) {
+        sorted_names.emplace_back(&it.first, it.second);
+    }
+    std::sort(
+        sorted_names.begin(), sorted_names.end(),
+        [](const std::pair<const std::string*, LinkId_t>& lhs, const std::pair<const std::string*, LinkId_t>& rhs) {
+            return *lhs.first < *rhs.first;
+        });
+
+    LinkId_t count = 1;
+    for ( auto& it : sorted_names ) {
         ConfigLink* link = links[it.second];
         link->order      = count;
         count++;
     }
+    std::unordered_map<std::string, LinkId_t>().swap(link_names);
+    link_names_cleared = true;
 }
 
 // Checks for errors that can't be easily detected during the build
@@ -742,6 +805,9 @@ ConfigGraph::checkForStructuralErrors()
     // Loop over all the Components
     for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
         ConfigComponent* ccomp = *iter;
+        // Remote components carry the ports of their subcomponents and
+        // are checked by the rank that builds them
+        if ( remote_comps.find(ccomp->id) != remote_comps.end() ) continue;
         ccomp->checkPorts();
     }
 
@@ -798,8 +864,81 @@ ConfigGraph::addLink(
     ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
     bool no_cut)
 {
+    checkLinkNamesAvailable(link_name);
+    checkForValidLinkName(link_name);
+
+    // In a distributed build, the other end may already have been
+    // added on a component that another rank builds
+    if ( !remote_link_ends.empty() ) {
+        auto remote = remote_link_ends.find(link_name);
+        if ( remote != remote_link_ends.end() ) {
+            const RemoteLinkEnd& end  = remote->second;
+            ConfigLink*          link = addLinkEnd(end.comp_id, link_name, end.port, end.latency_str, end.no_cut);
+            addRemoteComponent(end.comp_id, end.comp_name, end.comp_type, end.rank)->links.push_back(link->id);
+            remote_link_ends.erase(remote);
+        }
+    }
+
+    ConfigLink* link = addLinkEnd(comp_id, link_name, port, latency_str, no_cut);
+
+    // Need to add this link to the ConfigComponent's link list.
+    // Check to make sure the link doesn't already exist in the
+    // component.  Only possible way it could be there is if the link
+    // is attached to the component at both ends.  So, if this is the
+    // first reference to the link, or if link->component[0] is not
+    // equal to the current component sent into this call, then it is
+    // not already in the list.
+    if ( link->order == 1 || link->component[0] != comp_id ) {
+        auto compLinks = &findComponent(comp_id)->links;
+        compLinks->push_back(link->id);
+    }
+}
+
+void
+ConfigGraph::addRemoteLink(
+    ComponentId_t comp_id, const std::string& comp_name, const std::string& comp_type, RankInfo rank,
+    const std::string& link_name, const std::string& port, const std::string& latency_str, bool no_cut)
+{
+    checkLinkNamesAvailable(link_name);
     checkForValidLinkName(link_name);
 
+    // The other end is on a component built by this rank
+    if ( link_names.find(link_name) != link_names.end() ) {
+        ConfigLink* link = addLinkEnd(comp_id, link_name, port, latency_str, no_cut);
+        addRemoteComponent(comp_id, comp_name, comp_type, rank)->links.push_back(link->id);
+        return;
+    }
+
+    // Both ends are built by other ranks, so this rank doesn't need
+    // the link
+    auto remote = remote_link_ends.find(link_name);
+    if ( remote != remote_link_ends.end() ) {
+        remote_link_ends.erase(remote);
+        return;
+    }
+
+    // Wait to see where the other end is
+    remote_link_ends.emplace(
+        link_name, RemoteLinkEnd { comp_id, comp_name, comp_type, rank, port, latency_str, no_cut });
+}
+
+ConfigComponent*
+ConfigGraph::addRemoteComponent(
+    ComponentId_t comp_id, const std::string& comp_name, const std::string& comp_type, RankInfo rank)
+{
+    auto found = remote_comps.find(comp_id);
+    if ( found != remote_comps.end() ) return found->second;
+
+    ConfigComponent* comp = new ConfigComponent(comp_id, this, comp_name, comp_type, 1.0f, rank);
+    remote_comps.emplace(comp_id, comp);
+    return comp;
+}
+
+ConfigLink*
+ConfigGraph::addLinkEnd(
+    ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
+    bool no_cut)
+{
     // If the link already exists, it just gets it out of the links
     // data structure.  If the link does not exist, we create it, add
     // the link_name to id mapping (the id is links.size()) and add
@@ -825,22 +964,25 @@ ConfigGraph::addLink(
     link->latency_str[index] = latency_str;
     link->no_cut             = link->no_cut | no_cut;
 
-    // Need to add this link to the ConfigComponent's link list.
-    // Check to make sure the link doesn't already exist in the
-    // component.  Only possible way it could be there is if the link
-    // is attached to the component at both ends.  So, if this is the
-    // first reference to the link, or if link->component[0] is not
-    // equal to the current component sent into this call, then it is
-    // not already in the list.
-    if ( link->order == 1 || link->component[0] != comp_id ) {
-        auto compLinks = &findComponent(comp_id)->links;
-        compLinks->push_back(link->id);
+    return link;
+}
+
+void
+ConfigGraph::checkLinkNamesAvailable(const std::string& link_name)
+{
+    // Looking up a link by name after the names are gone would quietly
+    // create a new link instead
+    if ( link_names_cleared ) {
+        output.fatal(
+            CALL_INFO, 1, "ERROR: Link %s referenced by name after the graph was finalized\n", link_name.c_str());
     }
 }
 
 void
 ConfigGraph::setLinkNoCut(const std::string& link_name)
 {
+    checkLinkNamesAvailable(link_name);
+
     // If link doesn't exist, return
     if ( link_names.find(link_name) == link_names.end() ) return;
 
@@ -961,6 +1103,10 @@ ConfigGraph::getSubGraph(const std::set<uint32_t>& rank_set)
     graph->statOutputs = this->statOutputs;
     /* Only need to copy StatGroups which are referenced in this subgraph */
     for ( auto& kv : this->statGroups ) {
+        if ( isCollectiveStatGroup(kv.second, statOutputs) ) {
+            graph->statGroups.insert(std::make_pair(kv.first, kv.second));
+            continue;
+        }
         for ( auto& id : kv.second.components ) {
             if ( graph->containsComponent(id) ) {
                 graph->statGroups.insert(std::make_pair(kv.first, kv.second));
@@ -1150,6 +1296,10 @@ ConfigGraph::splitGraph(const std::set<uint32_t>& orig_rank_set, const std::set<
     for ( auto it = this->statGroups.begin(); it != this->statGroups.end(); /* increment in loop body */ ) {
         bool copy   = false;
         bool remove = true;
+        if ( isCollectiveStatGroup(it->second, statOutputs) ) {
+            copy   = true;
+            remove = false;
+        }
         for ( auto& id : it->second.components ) {
             if ( graph->containsComponent(id) ) {
                 copy = true;
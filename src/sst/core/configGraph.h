@@ -14,6 +14,7 @@
 #ifndef SST_CORE_CONFIGGRAPH_H
 #define SST_CORE_CONFIGGRAPH_H
 
+#include "sst/core/internedString.h"
 #include "sst/core/params.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/serialization/serializable.h"
@@ -26,6 +27,7 @@
 #include <climits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 using namespace SST::Statistics;
@@ -45,12 +47,12 @@ typedef std::vector<LinkId_t>          LinkIdMap_t;
 class ConfigLink : public SST::Core::Serialization::serializable
 {
 public:
-    LinkId_t      id;             /*!< ID of this link */
-    std::string   name;           /*!< Name of this link */
-    ComponentId_t component[2];   /*!< IDs of the connected components */
-    std::string   port[2];        /*!< Names of the connected ports */
-    SimTime_t     latency[2];     /*!< Latency from each side */
-    std::string   latency_str[2]; /*!< Temp string holding latency */
+    LinkId_t             id;             /*!< ID of this link */
+    std::string          name;           /*!< Name of this link */
+    ComponentId_t        component[2];   /*!< IDs of the connected components */
+    Core::InternedString port[2];        /*!< Names of the connected ports */
+    SimTime_t            latency[2];     /*!< Latency from each side */
+    Core::InternedString latency_str[2]; /*!< Temp string holding latency */
 
     LinkId_t order;  /*!< Number of components currently referring to this Link.  After graph construction, it will
                        be repurposed to hold the enforce_order value */
@@ -163,14 +165,16 @@ public:
     std::vector<ComponentId_t>    components;
     size_t                        outputID;
     UnitAlgebra                   outputFrequency;
+    bool                          mergeStats;
 
-    ConfigStatGroup(const std::string& name) : name(name), outputID(0) {}
+    ConfigStatGroup(const std::string& name) : name(name), outputID(0), mergeStats(false) {}
     ConfigStatGroup() {} /* Do not use */
 
     bool addComponent(ComponentId_t id);
     bool addStatistic(const std::string& name, Params& p);
     bool setOutput(size_t id);
     bool setFrequency(const std::string& freq);
+    bool setMerge(bool merge);
 
     /**
      * Checks to make sure that all components in the group support all
@@ -186,6 +190,7 @@ public:
         ser& components;
         ser& outputID;
         ser& outputFrequency;
+        ser& mergeStats;
     }
 
     ImplementSerializable(SST::ConfigStatGroup)
@@ -223,7 +228,7 @@ public:
     ConfigGraph*          graph;         /*!< Graph that this component belongs to */
     std::string           name;          /*!< Name of this component, or slot name for subcomp */
     int                   slot_num;      /*!< Slot number.  Only valid for subcomponents */
-    std::string           type;          /*!< Type of this component */
+    Core::InternedString  type;          /*!< Type of this component */
     float                 weight;        /*!< Partitioning weight for this component */
     RankInfo              rank;          /*!< Parallel Rank for this component */
     std::vector<LinkId_t> links;         /*!< List of links connected */
@@ -233,7 +238,8 @@ public:
 
     std::map<std::string, StatisticId_t> enabledStatNames;
     bool                                 enabledAllStats;
-    ConfigStatistic                      allStatConfig;
+    /** Statistic settings for enableAllStatistics.  Only created once used, since most components never do */
+    ConfigStatistic*                     allStatConfig;
 
     std::vector<ConfigComponent*> subComponents; /*!< List of subcomponents */
     std::vector<double>           coords;
@@ -252,11 +258,15 @@ public:
     ConfigComponent* cloneWithoutLinksOrParams(ConfigGraph* new_graph) const;
     void             setConfigGraphPointer(ConfigGraph* graph_ptr);
 
-    ~ConfigComponent() {}
+    ~ConfigComponent() { delete allStatConfig; }
+    // Owns allStatConfig, so a copy would delete it twice
+    ConfigComponent(const ConfigComponent&) = delete;
+    ConfigComponent& operator=(const ConfigComponent&) = delete;
     ConfigComponent() :
         id(null_id),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
+        allStatConfig(nullptr),
         nextSubID(1),
         visited(false)
     {}
@@ -270,6 +280,7 @@ public:
     void                   setWeight(double w);
     void                   setCoordinates(const std::vector<double>& c);
     void                   addParameter(const std::string& key, const std::string& value, bool overwrite);
+    void                   addParameters(const std::map<std::string, std::string>& params);
     ConfigComponent*       addSubComponent(const std::string& name, const std::string& type, int slot);
     ConfigComponent*       findSubComponent(ComponentId_t);
     const ConfigComponent* findSubComponent(ComponentId_t) const;
@@ -327,6 +338,9 @@ private:
 
     ComponentId_t getNextSubComponentID();
 
+    /** Returns allStatConfig, creating it on first use */
+    ConfigStatistic* getAllStatConfig();
+
     friend class ConfigGraph;
     /** Checks to make sure port names are valid and that a port isn't used twice
      */
@@ -344,6 +358,7 @@ private:
         rank(rank),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
+        allStatConfig(nullptr),
         nextSubID(1),
         nextStatID(1)
     {
@@ -362,6 +377,7 @@ private:
         rank(rank),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
+        allStatConfig(nullptr),
         nextSubID(parent_subid),
         nextStatID(parent_subid)
     {
@@ -375,7 +391,7 @@ private:
 /** Map IDs to Components */
 typedef SparseVectorMap<ComponentId_t, ConfigComponent*> ConfigComponentMap_t;
 /** Map names to Components */
-typedef std::map<std::string, ComponentId_t>             ConfigComponentNameMap_t;
+typedef std::unordered_map<std::string, ComponentId_t>   ConfigComponentNameMap_t;
 /** Map names to Parameter Sets: XML only */
 typedef std::map<std::string, Params*>                   ParamsMap_t;
 /** Map names to variable values:  XML only */
@@ -398,7 +414,7 @@ public:
         }
     }
 
-    ConfigGraph() : nextComponentId(0)
+    ConfigGraph() : nextComponentId(0), link_names_cleared(false)
     {
         links.clear();
         comps.clear();
@@ -423,6 +439,16 @@ public:
     /** Create a new component */
     ComponentId_t addComponent(const std::string& name, const std::string& type);
 
+    /** Return the id the next component added will get */
+    ComponentId_t getNextComponentId() const { return nextComponentId; }
+
+    /**
+       Take the next component id for a component that another rank
+       builds in a distributed build, so that every rank numbers the
+       components the same way.
+    */
+    ComponentId_t reserveComponentId() { return nextComponentId++; }
+
     /** Add a parameter to a global param set */
     void addGlobalParam(const std::string& global_set, const std::string& key, const std::string& value);
 
@@ -449,6 +475,16 @@ public:
         ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
         bool no_cut = false);
 
+    /**
+       Add a Link to a Component that another rank builds in a
+       distributed build.  The link is only kept if its other end is
+       on a component built by this rank.  The remote component is
+       then added to the graph with just its name, type and rank.
+    */
+    void addRemoteLink(
+        ComponentId_t comp_id, const std::string& comp_name, const std::string& comp_type, RankInfo rank,
+        const std::string& link_name, const std::string& port, const std::string& latency_str, bool no_cut = false);
+
     /** Set a Link to be no-cut */
     void setLinkNoCut(const std::string& link_name);
 
@@ -502,6 +538,7 @@ public:
         ser& statOutputs;
         ser& statLoadLevel;
         ser& statGroups;
+        ser& link_names_cleared;
         if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
             // Need to reintialize the ConfigGraph ptrs in the
             // ConfigComponents
@@ -519,10 +556,37 @@ private:
 
     ConfigLinkMap_t                        links;       // SparseVectorMap
     ConfigComponentMap_t                   comps;       // SparseVectorMap
-    ConfigComponentNameMap_t               compsByName; // std::map
+    ConfigComponentNameMap_t               compsByName; // std::unordered_map
     std::map<std::string, ConfigStatGroup> statGroups;
 
-    std::map<std::string, LinkId_t> link_names;
+    // Only needed while the graph is built, cleared by postCreationCleanup()
+    std::unordered_map<std::string, LinkId_t> link_names;
+    bool                                      link_names_cleared;
+
+    // Only used in a distributed build
+    struct RemoteLinkEnd
+    {
+        ComponentId_t comp_id;
+        std::string   comp_name;
+        std::string   comp_type;
+        RankInfo      rank;
+        std::string   port;
+        std::string   latency_str;
+        bool          no_cut;
+    };
+    /** Link ends on remote components, waiting for the other end */
+    std::map<std::string, RemoteLinkEnd> remote_link_ends;
+    /** Remote components connected to this rank, also added to comps when the build is done */
+    std::map<ComponentId_t, ConfigComponent*> remote_comps;
+
+    ConfigLink* addLinkEnd(
+        ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
+        bool no_cut);
+
+    ConfigComponent* addRemoteComponent(
+        ComponentId_t comp_id, const std::string& comp_name, const std::string& comp_type, RankInfo rank);
+
+    void checkLinkNamesAvailable(const std::string& link_name);
 
     std::vector<ConfigStatOutput> statOutputs; // [0] is default
     uint8_t                       statLoadLevel;
@@ -579,6 +643,7 @@ public:
     ComponentId_t component[2];
     SimTime_t     latency[2];
     bool          no_cut;
+    float         weight; /*!< Relative cost of cutting this link */
 
     PartitionLink(const ConfigLink& cl)
     {
@@ -588,6 +653,7 @@ public:
         latency[0]   = cl.latency[0];
         latency[1]   = cl.latency[1];
         no_cut       = cl.no_cut;
+        weight       = 1.0;
     }
 
     inline LinkId_t key() const { return id; }
@@ -48,8 +48,23 @@ Event::generateUniqueId()
 }
 
 #ifdef USE_MEMPOOL
-std::mutex                        Activity::poolMutex;
-std::vector<Activity::PoolInfo_t> Activity::memPools;
+std::mutex                               Activity::poolMutex;
+std::vector<Activity::PoolInfo_t>        Activity::memPools;
+thread_local std::vector<Core::MemPool*> Activity::threadPools;
+
+Core::MemPool*
+Activity::createMemPool(size_t size_class)
+{
+    size_t         size = size_class * sizeof(PoolData_t);
+    Core::MemPool* pool = new Core::MemPool(size + sizeof(PoolData_t));
+
+    if ( threadPools.size() <= size_class ) threadPools.resize(size_class + 1, nullptr);
+    threadPools[size_class] = pool;
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    memPools.emplace_back(std::this_thread::get_id(), size, pool);
+    return pool;
+}
 #endif
 
 } // namespace SST
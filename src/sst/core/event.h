@@ -116,7 +116,12 @@ public:
     void serialize_order(SST::Core::Serialization::serializer& ser) override
     {
         Activity::serialize_order(ser);
-        ser& delivery_info;
+        // The header is only skipped for the outermost event, so clear
+        // the flag before any Activities in the payload
+        if ( ser.skip_activity_header() )
+            ser.set_skip_activity_header(false);
+        else
+            ser& delivery_info;
 #ifdef __SST_DEBUG_EVENT_TRACKING__
         ser& first_comp;
         ser& first_type;
@@ -138,6 +143,7 @@ private:
     friend class Link;
     friend class NullEvent;
     friend class RankSync;
+    friend class SyncQueue;
     friend class ThreadSync;
 
 
@@ -68,11 +68,13 @@ SimulatorHeartbeat::execute(void)
     uint64_t global_max_sync_data_size = 0, global_sync_data_size = 0;
 
     uint64_t mempool_size      = 0;
+    uint64_t mempool_reserved  = 0;
     uint64_t active_activities = 0;
 #ifdef USE_MEMPOOL
-    Activity::getMemPoolUsage(mempool_size, active_activities);
+    Activity::getMemPoolUsage(mempool_size, mempool_reserved, active_activities);
 #endif
     uint64_t max_mempool_size, global_mempool_size, global_active_activities;
+    uint64_t max_mempool_reserved, global_mempool_reserved;
 
 #ifdef SST_CONFIG_HAVE_MPI
     uint64_t local_sync_data_size = Simulation_impl::getSimulation()->getSyncQueueDataSize();
@@ -82,6 +84,8 @@ SimulatorHeartbeat::execute(void)
     MPI_Allreduce(&local_sync_data_size, &global_sync_data_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_reserved, &max_mempool_reserved, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_reserved, &global_mempool_reserved, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
 #else
     global_max_tv_depth       = local_max_tv_depth;
@@ -89,6 +93,8 @@ SimulatorHeartbeat::execute(void)
     global_max_sync_data_size = 0;
     max_mempool_size          = mempool_size;
     global_mempool_size       = mempool_size;
+    max_mempool_reserved      = mempool_reserved;
+    global_mempool_reserved   = mempool_reserved;
     global_active_activities  = active_activities;
 #endif
 
@@ -107,8 +113,17 @@ SimulatorHeartbeat::execute(void)
         ua_str = format_string("%" PRIu64 "B", global_mempool_size);
         UnitAlgebra global_mempool_size_ua(ua_str);
 
+        ua_str = format_string("%" PRIu64 "B", max_mempool_reserved);
+        UnitAlgebra max_mempool_reserved_ua(ua_str);
+
+        ua_str = format_string("%" PRIu64 "B", global_mempool_reserved);
+        UnitAlgebra global_mempool_reserved_ua(ua_str);
+
         sim_output.output("\tMax mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
         sim_output.output("\tGlobal mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
+        sim_output.output("\tMax mempool reserved:            %s\n", max_mempool_reserved_ua.toStringBestSI().c_str());
+        sim_output.output(
+            "\tGlobal mempool reserved:         %s\n", global_mempool_reserved_ua.toStringBestSI().c_str());
         sim_output.output("\tGlobal active activities         %" PRIu64 " activities\n", global_active_activities);
         sim_output.output("\tMax TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
         sim_output.output(
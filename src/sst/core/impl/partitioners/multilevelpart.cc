@@ -0,0 +1,551 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace SST::IMPL::Partition;
+
+namespace {
+
+const uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+/** Stop coarsening once a graph is this small */
+const uint32_t COARSEN_TO = 64;
+
+/** Allowed imbalance, as a fraction of the weight of one part */
+const double IMBALANCE = 0.03;
+
+/** Undirected graph in compressed sparse row form.  The neighbors of
+ * vertex v are adjncy[xadj[v]] to adjncy[xadj[v + 1] - 1]. */
+struct Graph
+{
+    std::vector<size_t>   xadj;
+    std::vector<uint32_t> adjncy;
+    std::vector<double>   adjwgt;
+    std::vector<double>   vwgt;
+
+    uint32_t size() const { return vwgt.size(); }
+    double   totalWeight() const { return std::accumulate(vwgt.begin(), vwgt.end(), 0.0); }
+    double   maxWeight() const { return vwgt.empty() ? 0.0 : *std::max_element(vwgt.begin(), vwgt.end()); }
+};
+
+typedef std::priority_queue<std::pair<double, uint32_t>> GainQueue;
+
+/** Contract a heavy edge matching of fine into coarse.  cmap gets the
+ * coarse vertex of each fine vertex. */
+void
+coarsen(const Graph& fine, double maxVertexWeight, std::mt19937& rng, Graph& coarse, std::vector<uint32_t>& cmap)
+{
+    const uint32_t        n = fine.size();
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<uint32_t> match(n, NO_VERTEX);
+    std::vector<uint32_t> leader;
+    cmap.assign(n, 0);
+    for ( uint32_t v : order ) {
+        if ( NO_VERTEX != match[v] ) continue;
+
+        uint32_t best       = v;
+        double   bestWeight = -1;
+        for ( size_t j = fine.xadj[v]; j < fine.xadj[v + 1]; j++ ) {
+            uint32_t u = fine.adjncy[j];
+            if ( NO_VERTEX == match[u] && fine.adjwgt[j] > bestWeight &&
+                 fine.vwgt[v] + fine.vwgt[u] <= maxVertexWeight ) {
+                best       = u;
+                bestWeight = fine.adjwgt[j];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+        cmap[v]     = leader.size();
+        cmap[best]  = leader.size();
+        leader.push_back(v);
+    }
+
+    // Combine the links of each matched pair, dropping the one between them
+    const uint32_t      nCoarse = leader.size();
+    std::vector<size_t> slot(nCoarse, std::numeric_limits<size_t>::max());
+    coarse.vwgt.assign(nCoarse, 0.0);
+    coarse.xadj.assign(1, 0);
+    coarse.adjncy.clear();
+    coarse.adjwgt.clear();
+    for ( uint32_t c = 0; c < nCoarse; c++ ) {
+        uint32_t pair[2] = { leader[c], match[leader[c]] };
+        for ( int p = 0; p < (pair[0] == pair[1] ? 1 : 2); p++ ) {
+            uint32_t v = pair[p];
+            coarse.vwgt[c] += fine.vwgt[v];
+            for ( size_t j = fine.xadj[v]; j < fine.xadj[v + 1]; j++ ) {
+                uint32_t cu = cmap[fine.adjncy[j]];
+                if ( cu == c ) continue;
+                if ( std::numeric_limits<size_t>::max() == slot[cu] ) {
+                    slot[cu] = coarse.adjncy.size();
+                    coarse.adjncy.push_back(cu);
+                    coarse.adjwgt.push_back(fine.adjwgt[j]);
+                }
+                else {
+                    coarse.adjwgt[slot[cu]] += fine.adjwgt[j];
+                }
+            }
+        }
+        for ( size_t j = coarse.xadj.back(); j < coarse.adjncy.size(); j++ ) {
+            slot[coarse.adjncy[j]] = std::numeric_limits<size_t>::max();
+        }
+        coarse.xadj.push_back(coarse.adjncy.size());
+    }
+}
+
+/** Total weight of the links between the two sides */
+double
+getCut(const Graph& g, const std::vector<uint8_t>& side)
+{
+    double cut = 0;
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; j++ ) {
+            if ( side[v] != side[g.adjncy[j]] ) cut += g.adjwgt[j];
+        }
+    }
+    return cut / 2;
+}
+
+/** Improve a bisection with Fiduccia-Mattheyses passes.  A pass moves
+ * the vertex with the highest gain, even if that makes the cut worse,
+ * until it stops finding better bisections, then keeps the best one.
+ * A bisection is better if it is balanced and has a smaller cut, or if
+ * it is less out of balance. */
+void
+refineBisection(const Graph& g, std::vector<uint8_t>& side, double target0, double tolerance)
+{
+    const uint32_t        n = g.size();
+    std::vector<double>   gain(n);
+    std::vector<uint8_t>  moved(n);
+    std::vector<uint32_t> moves;
+    const size_t          maxUseless = std::min<size_t>(n, std::max<size_t>(50, n / 100));
+
+    for ( int pass = 0; pass < 8; pass++ ) {
+        // gain is how much moving a vertex to the other side lowers the cut
+        double    weight0 = 0;
+        double    cut     = 0;
+        GainQueue queue[2];
+        for ( uint32_t v = 0; v < n; v++ ) {
+            if ( 0 == side[v] ) weight0 += g.vwgt[v];
+            gain[v]       = 0;
+            bool boundary = false;
+            for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; j++ ) {
+                if ( side[v] != side[g.adjncy[j]] ) {
+                    gain[v] += g.adjwgt[j];
+                    boundary = true;
+                }
+                else {
+                    gain[v] -= g.adjwgt[j];
+                }
+            }
+            if ( boundary ) queue[side[v]].emplace(gain[v], v);
+        }
+        cut = getCut(g, side);
+        std::fill(moved.begin(), moved.end(), 0);
+        moves.clear();
+
+        double excess       = weight0 - target0;
+        double bestCut      = cut;
+        double bestExcess   = std::fabs(excess);
+        bool   bestBalanced = bestExcess <= tolerance;
+        size_t bestMoves    = 0;
+
+        while ( moves.size() - bestMoves < maxUseless ) {
+            // Discard queue entries for vertices that moved or whose
+            // gain changed since they were queued
+            uint32_t top[2];
+            for ( int s = 0; s < 2; s++ ) {
+                top[s] = NO_VERTEX;
+                while ( !queue[s].empty() ) {
+                    uint32_t v = queue[s].top().second;
+                    if ( !moved[v] && side[v] == s && queue[s].top().first == gain[v] ) {
+                        top[s] = v;
+                        break;
+                    }
+                    queue[s].pop();
+                }
+            }
+
+            // Move off a side that is over its target, otherwise make
+            // the best move that stays in balance
+            int from = -1;
+            if ( excess > tolerance )
+                from = 0;
+            else if ( excess < -tolerance )
+                from = 1;
+            else {
+                for ( int s = 0; s < 2; s++ ) {
+                    if ( NO_VERTEX == top[s] ) continue;
+                    double after = (0 == s) ? excess - g.vwgt[top[s]] : excess + g.vwgt[top[s]];
+                    if ( std::fabs(after) > tolerance ) continue;
+                    if ( -1 == from || gain[top[s]] > gain[top[from]] ) from = s;
+                }
+            }
+            if ( -1 == from || NO_VERTEX == top[from] ) break;
+
+            uint32_t v = top[from];
+            queue[from].pop();
+            side[v]  = 1 - from;
+            moved[v] = 1;
+            moves.push_back(v);
+            cut -= gain[v];
+            excess += (0 == from) ? -g.vwgt[v] : g.vwgt[v];
+
+            for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; j++ ) {
+                uint32_t u = g.adjncy[j];
+                if ( moved[u] ) continue;
+                gain[u] += (side[u] == side[v]) ? -2 * g.adjwgt[j] : 2 * g.adjwgt[j];
+                queue[side[u]].emplace(gain[u], u);
+            }
+
+            bool balanced = std::fabs(excess) <= tolerance;
+            if ( balanced ? (!bestBalanced || cut < bestCut * (1 - 1e-12)) : std::fabs(excess) < bestExcess ) {
+                bestCut      = cut;
+                bestExcess   = std::fabs(excess);
+                bestBalanced = balanced;
+                bestMoves    = moves.size();
+            }
+        }
+
+        // Undo the moves made after the best bisection
+        for ( size_t i = bestMoves; i < moves.size(); i++ ) {
+            side[moves[i]] = 1 - side[moves[i]];
+        }
+        if ( 0 == bestMoves ) break;
+    }
+}
+
+/** Grow side 0 from seed, adding the vertex that raises the cut least,
+ * until it holds target0 of the weight */
+void
+growBisection(const Graph& g, uint32_t seed, double target0, std::vector<uint8_t>& side)
+{
+    const uint32_t      n = g.size();
+    std::vector<double> gain(n, 0.0);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; j++ ) {
+            gain[v] -= g.adjwgt[j];
+        }
+    }
+    side.assign(n, 1);
+
+    GainQueue queue;
+    queue.emplace(gain[seed], seed);
+    uint32_t next    = 0;
+    double   weight0 = 0;
+    while ( weight0 < target0 ) {
+        uint32_t v = NO_VERTEX;
+        while ( !queue.empty() ) {
+            uint32_t u = queue.top().second;
+            if ( 1 == side[u] && queue.top().first == gain[u] ) {
+                v = u;
+                break;
+            }
+            queue.pop();
+        }
+        // Start over in a part of the graph not connected to side 0
+        if ( NO_VERTEX == v ) {
+            while ( next < n && 0 == side[next] )
+                next++;
+            if ( next == n ) break;
+            v = next;
+        }
+        else {
+            queue.pop();
+        }
+
+        // Stop short if that is closer to the target
+        if ( weight0 > 0 && weight0 + g.vwgt[v] - target0 > target0 - weight0 ) break;
+
+        side[v] = 0;
+        weight0 += g.vwgt[v];
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; j++ ) {
+            uint32_t u = g.adjncy[j];
+            if ( 0 == side[u] ) continue;
+            gain[u] += 2 * g.adjwgt[j];
+            queue.emplace(gain[u], u);
+        }
+    }
+}
+
+/** Split g in two, with target0 of the vertex weight on side 0 */
+void
+bisect(const Graph& g, double target0, double tolerance, std::mt19937& rng, std::vector<uint8_t>& side)
+{
+    // Coarsen until the graph is small or stops shrinking
+    std::vector<Graph>                 levels;
+    std::vector<std::vector<uint32_t>> cmaps;
+    const Graph*                       current   = &g;
+    const double                       maxWeight = 1.5 * g.totalWeight() / COARSEN_TO;
+    while ( current->size() > COARSEN_TO ) {
+        Graph                 coarse;
+        std::vector<uint32_t> cmap;
+        coarsen(*current, maxWeight, rng, coarse, cmap);
+        if ( coarse.size() > 0.95 * current->size() ) break;
+        levels.push_back(std::move(coarse));
+        cmaps.push_back(std::move(cmap));
+        current = &levels.back();
+    }
+
+    // Bisect the coarsest graph from a few starting vertices and keep
+    // the best result
+    std::vector<uint8_t> trial;
+    double               bestCut    = 0;
+    double               bestExcess = 0;
+    const double         coarseTol  = std::max(tolerance, current->maxWeight());
+    for ( int i = 0; i < 4; i++ ) {
+        uint32_t seed = std::uniform_int_distribution<uint32_t>(0, current->size() - 1)(rng);
+        growBisection(*current, seed, target0, trial);
+        refineBisection(*current, trial, target0, coarseTol);
+
+        double weight0 = 0;
+        for ( uint32_t v = 0; v < current->size(); v++ ) {
+            if ( 0 == trial[v] ) weight0 += current->vwgt[v];
+        }
+        double cut    = getCut(*current, trial);
+        double excess = std::max(std::fabs(weight0 - target0) - coarseTol, 0.0);
+        if ( 0 == i || excess < bestExcess || (excess == bestExcess && cut < bestCut) ) {
+            side.swap(trial);
+            bestCut    = cut;
+            bestExcess = excess;
+        }
+    }
+
+    // Project the bisection back through the levels, refining each one
+    for ( size_t level = levels.size(); level-- > 0; ) {
+        const Graph&         fine = (0 == level) ? g : levels[level - 1];
+        std::vector<uint8_t> fineSide(fine.size());
+        for ( uint32_t v = 0; v < fine.size(); v++ ) {
+            fineSide[v] = side[cmaps[level][v]];
+        }
+        side.swap(fineSide);
+        refineBisection(fine, side, target0, std::max(tolerance, fine.maxWeight()));
+    }
+}
+
+/** The vertices of g on one side of a bisection, renumbered */
+void
+extractSide(
+    const Graph& g, const std::vector<uint32_t>& ids, const std::vector<uint8_t>& side, uint8_t which, Graph& sub,
+    std::vector<uint32_t>& subIds)
+{
+    std::vector<uint32_t> local(g.size(), NO_VERTEX);
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        if ( side[v] != which ) continue;
+        local[v] = subIds.size();
+        subIds.push_back(ids[v]);
+        sub.vwgt.push_back(g.vwgt[v]);
+    }
+
+    sub.xadj.assign(1, 0);
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        if ( side[v] != which ) continue;
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; j++ ) {
+            uint32_t u = g.adjncy[j];
+            if ( side[u] != which ) continue;
+            sub.adjncy.push_back(local[u]);
+            sub.adjwgt.push_back(g.adjwgt[j]);
+        }
+        sub.xadj.push_back(sub.adjncy.size());
+    }
+}
+
+/** Assign the vertices of g to parts [lo, hi).  Parts are numbered rank
+ * by rank, and ranges that span ranks are split on a rank boundary, so
+ * the links between ranks are cut first. */
+void
+partitionRange(
+    Graph& g, std::vector<uint32_t>& ids, uint32_t lo, uint32_t hi, uint32_t threads, double partWeight,
+    std::mt19937& rng, std::vector<uint32_t>& parts)
+{
+    if ( hi - lo == 1 || g.size() < 2 ) {
+        for ( uint32_t id : ids ) {
+            parts[id] = lo;
+        }
+        return;
+    }
+
+    uint32_t mid;
+    if ( lo / threads != (hi - 1) / threads ) {
+        uint32_t ranks = (hi - lo) / threads;
+        mid            = lo + (ranks / 2) * threads;
+    }
+    else {
+        mid = lo + (hi - lo) / 2;
+    }
+
+    double               target0 = g.totalWeight() * (mid - lo) / (hi - lo);
+    // Every level of bisection can add to the imbalance of a part, but
+    // the levels nearer the top spread it over more parts, so the total
+    // is at most twice the tolerance of one level
+    double               tol     = std::max(IMBALANCE * partWeight / 2, g.maxWeight());
+    std::vector<uint8_t> side;
+    bisect(g, target0, tol, rng, side);
+
+    Graph                 sub[2];
+    std::vector<uint32_t> subIds[2];
+    for ( uint8_t s = 0; s < 2; s++ ) {
+        extractSide(g, ids, side, s, sub[s], subIds[s]);
+    }
+    g   = Graph();
+    ids = std::vector<uint32_t>();
+
+    partitionRange(sub[0], subIds[0], lo, mid, threads, partWeight, rng, parts);
+    partitionRange(sub[1], subIds[1], mid, hi, threads, partWeight, rng, parts);
+}
+
+} // anonymous namespace
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo rankCount, RankInfo UNUSED(my_rank), int verbosity) :
+    rankcount(rankCount)
+{
+    partOutput = new Output("MultilevelPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* graph)
+{
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = graph->getLinkMap();
+
+    const uint32_t totalParts = rankcount.rank * rankcount.thread;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+
+    // Number the components, and find the two ends of each link from
+    // the components that list it
+    std::vector<PartitionComponent*>           comps;
+    std::unordered_map<LinkId_t, uint32_t>     firstEnd;
+    std::vector<std::pair<uint32_t, uint32_t>> ends;
+    std::vector<SimTime_t>                     latencies;
+    std::vector<double>                        linkWeights;
+    SimTime_t                                  minLatency = std::numeric_limits<SimTime_t>::max();
+    for ( PartitionComponentMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it ) {
+        uint32_t index = comps.size();
+        comps.push_back(*it);
+        for ( LinkId_t id : (*it)->links ) {
+            auto found = firstEnd.find(id);
+            if ( found == firstEnd.end() ) {
+                firstEnd.emplace(id, index);
+                continue;
+            }
+            SimTime_t latency = std::max<SimTime_t>(linkMap[id].getMinLatency(), 1);
+            ends.emplace_back(found->second, index);
+            latencies.push_back(latency);
+            linkWeights.push_back(linkMap[id].weight);
+            minLatency = std::min(minLatency, latency);
+            firstEnd.erase(found);
+        }
+    }
+    firstEnd.clear();
+
+    // Build the graph, combining the links between the same components.
+    // The lowest latency link has weight 1, scaled by the link's own
+    // weight, which comes from a profile of an earlier run if one was
+    // given.
+    const uint32_t n = comps.size();
+    Graph          g;
+    g.vwgt.resize(n);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        g.vwgt[v] = comps[v]->weight;
+    }
+    if ( g.totalWeight() <= 0 ) std::fill(g.vwgt.begin(), g.vwgt.end(), 1.0);
+
+    g.xadj.assign(n + 1, 0);
+    for ( auto& e : ends ) {
+        g.xadj[e.first + 1]++;
+        g.xadj[e.second + 1]++;
+    }
+    std::partial_sum(g.xadj.begin(), g.xadj.end(), g.xadj.begin());
+
+    std::vector<std::pair<uint32_t, double>> entries(g.xadj[n]);
+    std::vector<size_t>                      fill(g.xadj.begin(), g.xadj.end() - 1);
+    for ( size_t i = 0; i < ends.size(); i++ ) {
+        double weight                   = (double)minLatency / latencies[i] * linkWeights[i];
+        entries[fill[ends[i].first]++]  = std::make_pair(ends[i].second, weight);
+        entries[fill[ends[i].second]++] = std::make_pair(ends[i].first, weight);
+    }
+    fill.clear();
+
+    size_t row = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        std::sort(entries.begin() + row, entries.begin() + g.xadj[v + 1]);
+        for ( size_t j = row; j < g.xadj[v + 1]; j++ ) {
+            if ( j > row && entries[j].first == entries[j - 1].first )
+                g.adjwgt.back() += entries[j].second;
+            else {
+                g.adjncy.push_back(entries[j].first);
+                g.adjwgt.push_back(entries[j].second);
+            }
+        }
+        row           = g.xadj[v + 1];
+        g.xadj[v + 1] = g.adjncy.size();
+    }
+    entries.clear();
+
+    // Fixed seed, so the partition is the same every run
+    std::mt19937          rng(5489);
+    std::vector<uint32_t> parts(n, 0);
+    std::vector<uint32_t> ids(n);
+    std::vector<double>   weights    = g.vwgt;
+    double                partWeight = g.totalWeight() / totalParts;
+    std::iota(ids.begin(), ids.end(), 0);
+    partitionRange(g, ids, 0, totalParts, rankcount.thread, partWeight, rng, parts);
+
+    std::vector<double> partWeights(totalParts, 0.0);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        comps[v]->rank = RankInfo(parts[v] / rankcount.thread, parts[v] % rankcount.thread);
+        partWeights[parts[v]] += weights[v];
+    }
+
+    // Report what was cut between ranks
+    size_t    cutLinks      = 0;
+    SimTime_t minCutLatency = std::numeric_limits<SimTime_t>::max();
+    for ( size_t i = 0; i < ends.size(); i++ ) {
+        if ( comps[ends[i].first]->rank.rank != comps[ends[i].second]->rank.rank ) {
+            cutLinks++;
+            minCutLatency = std::min(minCutLatency, latencies[i]);
+        }
+    }
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10" PRIu32 "\n", n);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Links Cut Between Ranks:          %10zu\n", cutLinks);
+    if ( cutLinks > 0 ) {
+        partOutput->verbose(CALL_INFO, 1, 0, "- Minimum Latency Cut:              %10" PRIu64 "\n", minCutLatency);
+    }
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "- Largest Part Weight:              %10.2f (average %.2f)\n",
+        *std::max_element(partWeights.begin(), partWeights.end()), partWeight);
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
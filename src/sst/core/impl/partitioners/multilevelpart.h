@@ -0,0 +1,79 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a multilevel partition of an SST simulation configuration.  The
+graph is recursively bisected until there is a part for every thread on
+every rank, splitting between ranks before splitting between the threads
+of a rank.  Each bisection coarsens the graph by contracting its heaviest
+links, bisects the coarsest graph, then refines the bisection with
+Fiduccia-Mattheyses passes as the graph is uncoarsened.
+
+Links are weighted by the inverse of their minimum latency, so the cut
+avoids low latency links, which raises the lookahead between ranks, and
+then cuts as few links as it can.  Parts are balanced by component
+weight.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioning scheme which avoids cutting low latency links while balancing "
+        "component weight per thread.")
+
+protected:
+    /** Number of ranks and threads in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+public:
+    /**
+       Creates a new multilevel partition scheme.
+       \param rankCount Number of MPI ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTMultilevelPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
@@ -0,0 +1,302 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadder.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace IMPL {
+
+// Same ordering as TimeVortexPQ, but bottom is kept ascending so new
+// activities (which have the largest queue order) are usually
+// appended near the end
+static Activity::less<true, true, true> ladder_less;
+
+template <bool TS>
+TimeVortexLadderBase<TS>::TimeVortexLadderBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    top_last(0),
+    top_min(0),
+    top_max(0),
+    active_rungs(0),
+    bottom_head(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+    // Rungs are never reallocated, so references into them stay
+    // valid while a new rung is being spawned
+    rungs.resize(max_rungs);
+}
+
+template <bool TS>
+TimeVortexLadderBase<TS>::~TimeVortexLadderBase()
+{
+    // Activities in TimeVortexLadder all need to be deleted
+    for ( auto x : top ) {
+        delete x;
+    }
+    for ( auto& rung : rungs ) {
+        for ( auto& bucket : rung.buckets ) {
+            for ( auto x : bucket ) {
+                delete x;
+            }
+        }
+    }
+    for ( size_t i = bottom_head; i < bottom.size(); ++i ) {
+        delete bottom[i];
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexLadderBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+
+    SimTime_t time = activity->getDeliveryTime();
+
+    // Far future goes to top unsorted
+    if ( time > top_last ) {
+        if ( top.empty() ) {
+            top_min = time;
+            top_max = time;
+        }
+        else {
+            top_min = std::min(top_min, time);
+            top_max = std::max(top_max, time);
+        }
+        top.push_back(activity);
+        if ( TS ) slock.unlock();
+        return;
+    }
+
+    // Look for the coarsest rung that still owns this time
+    for ( size_t i = 0; i < active_rungs; ++i ) {
+        Rung& rung = rungs[i];
+        if ( rung.active() && time >= rung.currentStart() ) {
+            rung.buckets[rung.bucketIndex(time)].push_back(activity);
+            if ( TS ) slock.unlock();
+            return;
+        }
+    }
+
+    // Earlier than anything in the rungs, so it belongs in bottom
+    insertBottom(activity);
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( bottom_head == bottom.size() && !refillBottom() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = bottom[bottom_head++];
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret_val = nullptr;
+    if ( bottom_head != bottom.size() || refillBottom() ) ret_val = bottom[bottom_head];
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  top: %zu activities\n", top.size());
+    for ( size_t i = 0; i < active_rungs; ++i ) {
+        const Rung& rung  = rungs[i];
+        size_t      count = 0;
+        for ( size_t j = rung.cur; j < rung.nbuckets; ++j ) {
+            count += rung.buckets[j].size();
+        }
+        out.output(
+            "  rung %zu: start = %" PRIu64 ", width = %" PRIu64 ", %zu buckets, %zu activities\n", i, rung.start,
+            rung.width, rung.nbuckets - rung.cur, count);
+    }
+    out.output("  bottom: %zu activities\n", bottom.size() - bottom_head);
+    for ( size_t i = bottom_head; i < bottom.size(); ++i ) {
+        bottom[i]->print("    ", out);
+    }
+}
+
+// Called with the lock held
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insertBottom(Activity* activity)
+{
+    // Reclaim space from activities that have already been popped
+    if ( bottom_head > bucket_threshold && bottom_head > bottom.size() / 2 ) {
+        bottom.erase(bottom.begin(), bottom.begin() + bottom_head);
+        bottom_head = 0;
+    }
+
+    bottom.insert(std::upper_bound(bottom.begin() + bottom_head, bottom.end(), activity, ladder_less), activity);
+
+    // If bottom has grown too large, spread it into a new rung so
+    // that inserts don't degrade to a linear search.  This can't help
+    // if everything is at the same time.
+    if ( bottom.size() - bottom_head <= bucket_threshold || active_rungs == max_rungs ) return;
+    SimTime_t min = bottom[bottom_head]->getDeliveryTime();
+    SimTime_t max = bottom.back()->getDeliveryTime();
+    if ( min == max ) return;
+
+    bottom.erase(bottom.begin(), bottom.begin() + bottom_head);
+    bottom_head = 0;
+    spawnRung(min, max, bottom);
+}
+
+// Called with the lock held and bottom empty.  Returns false if there
+// are no activities left.
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::refillBottom()
+{
+    bottom.clear();
+    bottom_head = 0;
+
+    while ( true ) {
+        if ( active_rungs == 0 ) {
+            if ( top.empty() ) return false;
+            // Everything in top becomes the new first rung and top
+            // starts over after it
+            spawnRung(top_min, top_max, top);
+            top_last = rungs[0].last();
+            continue;
+        }
+
+        Rung& rung = rungs[active_rungs - 1];
+        while ( rung.active() && rung.buckets[rung.cur].empty() ) {
+            rung.cur++;
+        }
+        if ( !rung.active() ) {
+            // Retire the rung.  Everything it owned has been handed
+            // down, and the rung above it has already moved past the
+            // bucket it was spawned from.
+            active_rungs--;
+            continue;
+        }
+
+        std::vector<Activity*>& bucket = rung.buckets[rung.cur++];
+        if ( bucket.size() > bucket_threshold && active_rungs < max_rungs ) {
+            auto range = std::minmax_element(bucket.begin(), bucket.end(), [](Activity* lhs, Activity* rhs) {
+                return lhs->getDeliveryTime() < rhs->getDeliveryTime();
+            });
+            SimTime_t min = (*range.first)->getDeliveryTime();
+            SimTime_t max = (*range.second)->getDeliveryTime();
+            if ( min != max ) {
+                spawnRung(min, max, bucket);
+                continue;
+            }
+        }
+
+        // Small enough (or all at one time), so sort it into bottom
+        bottom.swap(bucket);
+        std::sort(bottom.begin(), bottom.end(), ladder_less);
+        return true;
+    }
+}
+
+// Called with the lock held.  Creates a new finest rung covering
+// [min,max] and moves all the activities in source into it.
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::spawnRung(SimTime_t min, SimTime_t max, std::vector<Activity*>& source)
+{
+    Rung& rung    = rungs[active_rungs++];
+    rung.nbuckets = source.size() < max_buckets ? source.size() : max_buckets;
+    rung.start    = min;
+    rung.width    = (max - min) / rung.nbuckets;
+    if ( rung.width != MAX_SIMTIME_T ) rung.width++;
+    rung.cur = 0;
+    if ( rung.buckets.size() < rung.nbuckets ) rung.buckets.resize(rung.nbuckets);
+
+    for ( auto x : source ) {
+        rung.buckets[rung.bucketIndex(x->getDeliveryTime())].push_back(x);
+    }
+    source.clear();
+}
+
+
+class TimeVortexLadder : public TimeVortexLadderBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder,
+        "sst",
+        "timevortex.ladder_queue",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a ladder queue (multi-level calendar queue) with O(1) amortized insert and pop.")
+
+
+    TimeVortexLadder(Params& params) : TimeVortexLadderBase<false>(params) {}
+    ~TimeVortexLadder() {}
+    SST_ELI_EXPORT(TimeVortexLadder)
+};
+
+class TimeVortexLadder_ts : public TimeVortexLadderBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder_ts,
+        "sst",
+        "timevortex.ladder_queue.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a ladder queue.  Do not reference this element directly, just specify sst.timevortex.ladder_queue and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexLadder_ts(Params& params) : TimeVortexLadderBase<true>(params) {}
+    ~TimeVortexLadder_ts() {}
+    SST_ELI_EXPORT(TimeVortexLadder_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,144 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a ladder queue (a multi-level
+ * calendar queue).  Activities are kept in three tiers:
+ *
+ *   top    - unsorted list of activities far in the future
+ *   rungs  - calendars of unsorted time buckets, each rung refining
+ *            one bucket of the rung above it
+ *   bottom - small sorted list holding the activities that will be
+ *            delivered next
+ *
+ * Activities are only sorted once they reach bottom, and each
+ * activity is moved a bounded number of times on its way there, so
+ * insert and pop are O(1) amortized.  Ordering is identical to
+ * TimeVortexPQ: delivery time, then priority/order tag, then queue
+ * order.
+ */
+template <bool TS>
+class TimeVortexLadderBase : public TimeVortex
+{
+
+public:
+    TimeVortexLadderBase(Params& params);
+    ~TimeVortexLadderBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    // One level of the ladder.  Bucket i holds activities with
+    // delivery times in [start + i*width, start + (i+1)*width), except
+    // the last bucket, which also holds anything later that is still
+    // owned by this rung.  Buckets before cur have already been handed
+    // to a lower rung or to bottom.
+    struct Rung
+    {
+        SimTime_t                           start;
+        SimTime_t                           width;
+        size_t                              cur;
+        size_t                              nbuckets;
+        std::vector<std::vector<Activity*>> buckets;
+
+        // True if this rung still owns some delivery times
+        inline bool active() const { return cur < nbuckets; }
+
+        // First delivery time that is still owned by this rung,
+        // saturating at MAX_SIMTIME_T
+        inline SimTime_t currentStart() const
+        {
+            if ( cur != 0 && width > (MAX_SIMTIME_T - start) / cur ) return MAX_SIMTIME_T;
+            return start + cur * width;
+        }
+
+        inline size_t bucketIndex(SimTime_t time) const
+        {
+            SimTime_t index = (time - start) / width;
+            return index < nbuckets ? index : nbuckets - 1;
+        }
+
+        // Last delivery time covered by the buckets, saturating at
+        // MAX_SIMTIME_T
+        inline SimTime_t last() const
+        {
+            if ( width > (MAX_SIMTIME_T - start) / nbuckets ) return MAX_SIMTIME_T;
+            return start + nbuckets * width - 1;
+        }
+    };
+
+    // Largest number of activities sorted into bottom at once before
+    // they are spread into a new rung instead
+    static const size_t bucket_threshold = 50;
+
+    // Largest number of buckets in a single rung
+    static const size_t max_buckets = 4096;
+
+    // Largest number of rungs
+    static const size_t max_rungs = 8;
+
+    void insertBottom(Activity* activity);
+    bool refillBottom();
+    void spawnRung(SimTime_t min, SimTime_t max, std::vector<Activity*>& source);
+
+    // Unsorted far-future activities, all with delivery time > top_last
+    std::vector<Activity*> top;
+    SimTime_t              top_last;
+    SimTime_t              top_min;
+    SimTime_t              top_max;
+
+    // Rungs are reused as they are retired to keep bucket storage
+    // around; only the first active_rungs entries are in use
+    std::vector<Rung> rungs;
+    size_t            active_rungs;
+
+    // Sorted ascending; activities before bottom_head have already
+    // been popped
+    std::vector<Activity*> bottom;
+    size_t                 bottom_head;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
@@ -0,0 +1,210 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexPackedHeap.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexPackedHeapBase<TS>::TimeVortexPackedHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    data(nullptr),
+    capacity(0),
+    count(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+    grow();
+}
+
+template <bool TS>
+TimeVortexPackedHeapBase<TS>::~TimeVortexPackedHeapBase()
+{
+    // Activities in TimeVortexPackedHeap all need to be deleted
+    for ( size_t i = 1; i <= count; ++i ) {
+        delete data[i].activity;
+    }
+    ::free(data);
+}
+
+template <bool TS>
+bool
+TimeVortexPackedHeapBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = count == 0;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexPackedHeapBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = count;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexPackedHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+
+    HeapEntry entry;
+    entry.delivery_time = activity->getDeliveryTime();
+    entry.priority_order =
+        (static_cast<uint64_t>(static_cast<uint32_t>(activity->getPriority())) << 32) | activity->getOrderTag();
+    entry.queue_order = activity->getQueueOrder();
+    entry.activity    = activity;
+
+    if ( count + 1 == capacity ) grow();
+
+    // Sift the hole up from the new leaf
+    size_t index = ++count;
+    while ( index > 1 ) {
+        size_t p = parent(index);
+        if ( !(entry < data[p]) ) break;
+        data[index] = data[p];
+        index       = p;
+    }
+    data[index] = entry;
+
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexPackedHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( count == 0 ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = data[1].activity;
+
+    // Sift the hole down from the root, then fill it with the last
+    // leaf
+    HeapEntry last  = data[count--];
+    size_t    index = 1;
+    while ( true ) {
+        size_t child = firstChild(index);
+        if ( child > count ) break;
+        size_t end      = child + 4 <= count + 1 ? child + 4 : count + 1;
+        size_t smallest = child;
+        for ( size_t i = child + 1; i < end; ++i ) {
+            if ( data[i] < data[smallest] ) smallest = i;
+        }
+        if ( !(data[smallest] < last) ) break;
+        data[index] = data[smallest];
+        index       = smallest;
+    }
+    data[index] = last;
+
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexPackedHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = count == 0 ? nullptr : data[1].activity;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexPackedHeapBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    for ( size_t i = 1; i <= count; ++i ) {
+        data[i].activity->print("  ", out);
+    }
+}
+
+// Doubles the size of the heap array.  The storage is cache line
+// aligned, which std::vector can't guarantee.
+template <bool TS>
+void
+TimeVortexPackedHeapBase<TS>::grow()
+{
+    size_t new_capacity = capacity == 0 ? 1024 : capacity * 2;
+    void*  ptr          = nullptr;
+    if ( posix_memalign(&ptr, 64, new_capacity * sizeof(HeapEntry)) != 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "TimeVortexPackedHeap failed to allocate space for %zu entries\n", new_capacity);
+    }
+    HeapEntry* new_data = static_cast<HeapEntry*>(ptr);
+    if ( data != nullptr ) {
+        std::memcpy(new_data, data, (count + 1) * sizeof(HeapEntry));
+        ::free(data);
+    }
+    data     = new_data;
+    capacity = new_capacity;
+}
+
+
+class TimeVortexPackedHeap : public TimeVortexPackedHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexPackedHeap,
+        "sst",
+        "timevortex.packed_heap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a 4-ary heap that stores the sort key of each activity inline.")
+
+
+    TimeVortexPackedHeap(Params& params) : TimeVortexPackedHeapBase<false>(params) {}
+    ~TimeVortexPackedHeap() {}
+    SST_ELI_EXPORT(TimeVortexPackedHeap)
+};
+
+class TimeVortexPackedHeap_ts : public TimeVortexPackedHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexPackedHeap_ts,
+        "sst",
+        "timevortex.packed_heap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a 4-ary heap with inline sort keys.  Do not reference this element directly, just specify sst.timevortex.packed_heap and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexPackedHeap_ts(Params& params) : TimeVortexPackedHeapBase<true>(params) {}
+    ~TimeVortexPackedHeap_ts() {}
+    SST_ELI_EXPORT(TimeVortexPackedHeap_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,91 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXPACKEDHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXPACKEDHEAP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a 4-ary heap whose entries carry a
+ * copy of each Activity's sort key.  Comparisons never dereference
+ * the Activity, so sifting only touches the heap array.  Entries are
+ * 32 bytes and the heap is laid out so that the four children of a
+ * node share two cache lines.
+ */
+template <bool TS>
+class TimeVortexPackedHeapBase : public TimeVortex
+{
+
+public:
+    TimeVortexPackedHeapBase(Params& params);
+    ~TimeVortexPackedHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    struct HeapEntry
+    {
+        SimTime_t delivery_time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const HeapEntry& rhs) const
+        {
+            if ( delivery_time != rhs.delivery_time ) return delivery_time < rhs.delivery_time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    // The root is stored at index 1 so that the children of node i,
+    // [4i-2, 4i+1], always start on a cache line boundary
+    static inline size_t firstChild(size_t index) { return 4 * index - 2; }
+    static inline size_t parent(size_t index) { return (index + 2) / 4; }
+
+    void grow();
+
+    // Cache line aligned storage; data[0] is unused padding
+    HeapEntry* data;
+    size_t     capacity;
+    size_t     count;
+    uint64_t   insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXPACKEDHEAP_H
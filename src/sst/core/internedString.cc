@@ -0,0 +1,57 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/internedString.h"
+
+#include "sst/core/threadsafe.h"
+
+#include <mutex>
+#include <unordered_set>
+
+namespace SST {
+namespace Core {
+
+namespace {
+
+// Strings may be interned from more than one thread
+ThreadSafe::Spinlock internLock;
+
+std::unordered_set<std::string>&
+internPool()
+{
+    static std::unordered_set<std::string> pool;
+    return pool;
+}
+
+} // anonymous namespace
+
+const std::string*
+InternedString::intern(const std::string& str)
+{
+    if ( str.empty() ) return &emptyString();
+
+    // Elements of an unordered_set never move, so the pointer stays
+    // valid as the pool grows
+    std::lock_guard<ThreadSafe::Spinlock> lock(internLock);
+    return &*internPool().insert(str).first;
+}
+
+const std::string&
+InternedString::emptyString()
+{
+    static const std::string empty;
+    return empty;
+}
+
+} // namespace Core
+} // namespace SST
@@ -0,0 +1,109 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_INTERNEDSTRING_H
+#define SST_CORE_INTERNEDSTRING_H
+
+#include "sst/core/serialization/serializable.h"
+
+#include <ostream>
+#include <string>
+
+namespace SST {
+namespace Core {
+
+/**
+   Immutable string that is stored only once, however many times it is
+   used.  Copies only copy a pointer and equal strings compare by
+   pointer.  Used in the ConfigGraph for strings that repeat across
+   every component or link, such as types, port names and latencies.
+   Interned strings are never freed, so it should not be used for
+   names that are unique to each component or link.
+*/
+class InternedString
+{
+public:
+    InternedString() : str_(&emptyString()) {}
+    InternedString(const std::string& str) : str_(intern(str)) {}
+    InternedString(const char* str) : str_(intern(str)) {}
+
+    const std::string& str() const { return *str_; }
+    operator const std::string&() const { return *str_; }
+
+    const char* c_str() const { return str_->c_str(); }
+    size_t      size() const { return str_->size(); }
+    bool        empty() const { return str_->empty(); }
+
+    bool operator==(const InternedString& other) const { return str_ == other.str_; }
+    bool operator!=(const InternedString& other) const { return str_ != other.str_; }
+    bool operator<(const InternedString& other) const { return *str_ < *other.str_; }
+
+private:
+    static const std::string* intern(const std::string& str);
+    static const std::string& emptyString();
+
+    const std::string* str_;
+};
+
+inline bool
+operator==(const InternedString& lhs, const std::string& rhs)
+{
+    return lhs.str() == rhs;
+}
+
+inline bool
+operator==(const std::string& lhs, const InternedString& rhs)
+{
+    return lhs == rhs.str();
+}
+
+inline bool
+operator!=(const InternedString& lhs, const std::string& rhs)
+{
+    return lhs.str() != rhs;
+}
+
+inline bool
+operator!=(const std::string& lhs, const InternedString& rhs)
+{
+    return lhs != rhs.str();
+}
+
+inline std::ostream&
+operator<<(std::ostream& os, const InternedString& str)
+{
+    return os << str.str();
+}
+
+namespace Serialization {
+
+template <>
+class serialize<InternedString>
+{
+public:
+    void operator()(InternedString& str, serializer& ser)
+    {
+        if ( ser.mode() == serializer::UNPACK ) {
+            std::string tmp;
+            ser.string(tmp);
+            str = tmp;
+        }
+        else {
+            ser.string(const_cast<std::string&>(str.str()));
+        }
+    }
+};
+
+} // namespace Serialization
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_INTERNEDSTRING_H
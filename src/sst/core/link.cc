@@ -74,6 +74,40 @@ private:
     std::vector<std::pair<SST::Profile::EventHandlerProfileTool*, uintptr_t>> tools;
 };
 
+/**
+ * Wakes up suspended clock handlers when an event is delivered to a
+ * link's handler.  It is attached to the handler using the handler
+ * profiling hooks, so handlers without any wakeups pay nothing extra.
+ */
+class LinkClockWakeupList : public HandlerProfileToolAPI
+{
+public:
+    LinkClockWakeupList() : HandlerProfileToolAPI(0, "LinkClockWakeupList") {}
+
+    uintptr_t registerHandler(const HandlerMetaData& UNUSED(mdata)) override { return 0; }
+
+    void handlerStart(uintptr_t UNUSED(key)) override
+    {
+        for ( auto& x : wakeups ) {
+            x.first->wakeHandler(x.second);
+        }
+        wakeups.clear();
+    }
+
+    void outputData(FILE* UNUSED(fp)) override {}
+
+    void addWakeup(Clock* clock, Clock::HandlerBase* handler)
+    {
+        for ( auto& x : wakeups ) {
+            if ( x.first == clock && x.second == handler ) return;
+        }
+        wakeups.emplace_back(clock, handler);
+    }
+
+private:
+    std::vector<std::pair<Clock*, Clock::HandlerBase*>> wakeups;
+};
+
 Link::Link(LinkId_t tag) :
     send_queue(nullptr),
     delivery_info(0),
@@ -84,7 +118,8 @@ Link::Link(LinkId_t tag) :
     type(UNINITIALIZED),
     mode(INIT),
     tag(tag),
-    profile_tools(nullptr)
+    profile_tools(nullptr),
+    clock_wakeups(nullptr)
 {}
 
 Link::Link() :
@@ -97,7 +132,8 @@ Link::Link() :
     type(UNINITIALIZED),
     mode(INIT),
     tag(-1),
-    profile_tools(nullptr)
+    profile_tools(nullptr),
+    clock_wakeups(nullptr)
 {}
 
 Link::~Link()
@@ -112,6 +148,7 @@ Link::~Link()
     }
 
     if ( profile_tools ) delete profile_tools;
+    if ( clock_wakeups ) delete clock_wakeups;
 }
 
 void
@@ -228,6 +265,22 @@ Link::replaceFunctor(Event::HandlerBase* functor)
     pair_link->delivery_info = reinterpret_cast<uintptr_t>(functor);
 }
 
+void
+Link::addClockWakeup(Clock* clock, Clock::HandlerBase* handler)
+{
+    if ( UNLIKELY(type != HANDLER) ) {
+        Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+            CALL_INFO, 1, "Clock handlers can only be woken up by Links with an event handler installed\n");
+    }
+
+    if ( nullptr == clock_wakeups ) {
+        clock_wakeups = new LinkClockWakeupList();
+        reinterpret_cast<Event::HandlerBase*>(pair_link->delivery_info)
+            ->addProfileTool(clock_wakeups, HandlerMetaData());
+    }
+    clock_wakeups->addWakeup(clock, handler);
+}
+
 void
 Link::send_impl(SimTime_t delay, Event* event)
 {
@@ -12,6 +12,7 @@
 #ifndef SST_CORE_LINK_H
 #define SST_CORE_LINK_H
 
+#include "sst/core/clock.h"
 #include "sst/core/event.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/timeConverter.h"
@@ -28,6 +29,7 @@ class Simulation_impl;
 
 class UnitAlgebra;
 class LinkSendProfileToolList;
+class LinkClockWakeupList;
 
 namespace Profile {
 class EventHandlerProfileTool;
@@ -280,8 +282,13 @@ private:
 
     void addProfileTool(SST::Profile::EventHandlerProfileTool* tool, const EventHandlerMetaData& mdata);
 
+    /** Wake up a suspended clock handler the next time an event is
+     * delivered to the handler of this link */
+    void addClockWakeup(Clock* clock, Clock::HandlerBase* handler);
+
 
     LinkSendProfileToolList* profile_tools;
+    LinkClockWakeupList*     clock_wakeups;
 
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
@@ -34,6 +34,7 @@ REENABLE_WARNING
 #include "sst/core/model/sstmodel.h"
 #include "sst/core/objectComms.h"
 #include "sst/core/part/sstpart.h"
+#include "sst/core/profile/partitionProfile.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/statengine.h"
@@ -337,10 +338,9 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
         barrier.wait();
     }
 
-    if ( tid == 0 ) {
-        finalize_statEngineConfig();
-        delete info.graph;
-    }
+    // Every thread registers the clocks for the statistic groups
+    finalize_statEngineConfig();
+    if ( tid == 0 ) { delete info.graph; }
 
     force_rank_sequential_stop(info.config->rank_seq_startup(), info.myRank, info.world_size);
 
@@ -586,8 +586,9 @@ main(int argc, char* argv[])
     ////// Start ConfigGraph Creation //////
     ConfigGraph* graph = nullptr;
 
-    double start_graph_gen = sst_get_cpu_time();
-    graph                  = new ConfigGraph();
+    double   start_graph_gen     = sst_get_cpu_time();
+    uint64_t pre_graph_build_rss = localMemSize();
+    graph                        = new ConfigGraph();
 
     // Only rank 0 will populate the graph, unless we are using
     // parallel load.  In this case, all ranks will load the graph
@@ -635,8 +636,15 @@ main(int argc, char* argv[])
     double end_graph_gen = sst_get_cpu_time();
 
     if ( myRank.rank == 0 ) {
+        // RSS can drop if memory is returned to the OS during the build
+        uint64_t post_graph_build_rss = localMemSize();
+        uint64_t graph_build_rss =
+            post_graph_build_rss > pre_graph_build_rss ? post_graph_build_rss - pre_graph_build_rss : 0;
         g_output.verbose(CALL_INFO, 1, 0, "# ------------------------------------------------------------\n");
         g_output.verbose(CALL_INFO, 1, 0, "# Graph construction took %f seconds.\n", (end_graph_gen - start_graph_gen));
+        g_output.verbose(
+            CALL_INFO, 1, 0, "# Graph construction raised RSS by %" PRIu64 " KB for %zu components and %zu links\n",
+            graph_build_rss, graph->getNumComponents(), graph->getLinkMap().size());
     }
 
     ////// End ConfigGraph Creation //////
@@ -654,11 +662,34 @@ main(int argc, char* argv[])
         // Get the partitioner.  Built in partitioners are in the "sst" library.
         SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
 
+        // Take component and link weights from the profile of an
+        // earlier run, if one was given
+        SST::Profile::PartitionProfile profile;
+        bool                           use_profile = myRank.rank == 0 && cfg.partitionerProfile() != "";
+        if ( use_profile ) {
+            if ( !profile.load(cfg.partitionerProfile()) ) {
+                g_output.fatal(
+                    CALL_INFO, 1, "ERROR: Unable to read partitioner profile %s\n", cfg.partitionerProfile().c_str());
+            }
+            size_t count = profile.setComponentWeights(graph);
+            g_output.verbose(
+                CALL_INFO, 1, 0, "# Partitioner profile set the weight of %zu of %zu components\n", count,
+                graph->getComponentMap().size());
+        }
+
         try {
             if ( partitioner->requiresConfigGraph() ) { partitioner->performPartition(graph); }
             else {
                 PartitionGraph* pgraph;
-                if ( myRank.rank == 0 ) { pgraph = graph->getCollapsedPartitionGraph(); }
+                if ( myRank.rank == 0 ) {
+                    pgraph = graph->getCollapsedPartitionGraph();
+                    if ( use_profile ) {
+                        size_t count = profile.setLinkWeights(graph, pgraph);
+                        g_output.verbose(
+                            CALL_INFO, 1, 0, "# Partitioner profile set the weight of %zu of %zu links\n", count,
+                            pgraph->getLinkMap().size());
+                    }
+                }
                 else {
                     pgraph = new PartitionGraph();
                 }
@@ -835,6 +866,10 @@ main(int argc, char* argv[])
 #ifdef USE_MEMPOOL
     /* Estimate that we won't have more than 128 sizes of events */
     Activity::memPools.reserve(world_size.thread * 128);
+    if ( cfg.mempool_huge_pages() == "transparent" )
+        Core::MemPool::setHugePages(Core::MemPool::HugePages::TRANSPARENT);
+    else if ( cfg.mempool_huge_pages() == "explicit" )
+        Core::MemPool::setHugePages(Core::MemPool::HugePages::EXPLICIT);
 #endif
 
     std::vector<std::thread>     threads(world_size.thread);
@@ -894,9 +929,10 @@ main(int argc, char* argv[])
     uint64_t global_max_sync_data_size = 0, global_sync_data_size = 0;
 
     uint64_t mempool_size = 0, max_mempool_size = 0, global_mempool_size = 0;
+    uint64_t mempool_reserved = 0, max_mempool_reserved = 0, global_mempool_reserved = 0;
     uint64_t active_activities = 0, global_active_activities = 0;
 #ifdef USE_MEMPOOL
-    Activity::getMemPoolUsage(mempool_size, active_activities);
+    Activity::getMemPoolUsage(mempool_size, mempool_reserved, active_activities);
 #endif
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -911,6 +947,8 @@ main(int argc, char* argv[])
     MPI_Allreduce(&local_sync_data_size, &global_sync_data_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_reserved, &max_mempool_reserved, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_reserved, &global_mempool_reserved, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
 #else
     max_build_time            = build_time;
@@ -922,6 +960,8 @@ main(int argc, char* argv[])
     global_max_sync_data_size = 0;
     max_mempool_size          = mempool_size;
     global_mempool_size       = mempool_size;
+    max_mempool_reserved      = mempool_reserved;
+    global_mempool_reserved   = mempool_reserved;
     global_active_activities  = active_activities;
 #endif
 
@@ -952,6 +992,12 @@ main(int argc, char* argv[])
         ua_buffer = format_string("%" PRIu64 "B", global_mempool_size);
         UnitAlgebra global_mempool_size_ua(ua_buffer);
 
+        ua_buffer = format_string("%" PRIu64 "B", max_mempool_reserved);
+        UnitAlgebra max_mempool_reserved_ua(ua_buffer);
+
+        ua_buffer = format_string("%" PRIu64 "B", global_mempool_reserved);
+        UnitAlgebra global_mempool_reserved_ua(ua_buffer);
+
         g_output.output("\n");
         g_output.output("\n");
         g_output.output("------------------------------------------------------------\n");
@@ -970,6 +1016,8 @@ main(int argc, char* argv[])
         g_output.output("Max Input Blocks:                %" PRIu64 " blocks\n", global_max_io_in);
         g_output.output("Max mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
         g_output.output("Global mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
+        g_output.output("Max mempool reserved:            %s\n", max_mempool_reserved_ua.toStringBestSI().c_str());
+        g_output.output("Global mempool reserved:         %s\n", global_mempool_reserved_ua.toStringBestSI().c_str());
         g_output.output("Global active activities:        %" PRIu64 " activities\n", global_active_activities);
         g_output.output("Current global TimeVortex depth: %" PRIu64 " entries\n", global_current_tv_depth);
         g_output.output("Max TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
@@ -987,6 +1035,10 @@ main(int argc, char* argv[])
             out.setOutputLocation(Output::STDOUT);
         if ( cfg.event_dump_file() == "STDERR" || cfg.event_dump_file() == "stderr" )
             out.setOutputLocation(Output::STDERR);
+        out.output(
+            "Mempool usage on rank %" PRIu32 ": %" PRIu64 " bytes resident, %" PRIu64 " bytes reserved, %" PRIu64
+            " undeleted activities\n",
+            myRank.rank, mempool_size, mempool_reserved, active_activities);
         Activity::printUndeletedActivities("", out, MAX_SIMTIME_T);
     }
 #endif
@@ -0,0 +1,186 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/mempool.h"
+
+#include <algorithm>
+#include <unistd.h>
+
+namespace SST {
+namespace Core {
+
+std::atomic<size_t>                             MemPool::next_pool_id(0);
+thread_local std::vector<MemPool::ThreadCache*> MemPool::thread_caches;
+MemPool::HugePages                              MemPool::huge_pages = MemPool::HugePages::NONE;
+
+#ifdef __APPLE__
+typedef char mincore_vec_t;
+#else
+typedef unsigned char mincore_vec_t;
+#endif
+
+uint8_t*
+MemPool::mapArena()
+{
+    void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if ( huge_pages == HugePages::EXPLICIT ) {
+        ptr = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+        // If no huge pages are reserved, fall back to transparent
+        if ( MAP_FAILED != ptr ) return (uint8_t*)ptr;
+    }
+#endif
+#ifdef MADV_HUGEPAGE
+    if ( huge_pages != HugePages::NONE ) {
+        // Transparent huge pages are only used for huge page aligned
+        // ranges, so over allocate and unmap the ends
+        size_t length = arenaSize + huge_page_size;
+        ptr           = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if ( MAP_FAILED == ptr ) return nullptr;
+        uint8_t* start = (uint8_t*)ptr;
+        uint8_t* arena = (uint8_t*)(((uintptr_t)start + huge_page_size - 1) & ~(uintptr_t)(huge_page_size - 1));
+        if ( arena != start ) munmap(start, arena - start);
+        if ( arena + arenaSize != start + length ) munmap(arena + arenaSize, (start + length) - (arena + arenaSize));
+        madvise(arena, arenaSize, MADV_HUGEPAGE);
+        return arena;
+    }
+#endif
+    ptr = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if ( MAP_FAILED == ptr ) return nullptr;
+    return (uint8_t*)ptr;
+}
+
+uint64_t
+MemPool::getBytesResident()
+{
+    static const size_t        page_size = sysconf(_SC_PAGESIZE);
+    std::vector<mincore_vec_t> resident((arenaSize + page_size - 1) / page_size);
+
+    std::lock_guard<ThreadSafe::Spinlock> lock(arenaLock);
+    uint64_t                              bytes = 0;
+    auto                                  count = [&](uint8_t* arena) {
+        // If the kernel can't tell us, assume all of it is resident
+        if ( mincore(arena, arenaSize, resident.data()) != 0 ) {
+            bytes += arenaSize;
+            return;
+        }
+        for ( auto page : resident ) {
+            if ( page & 1 ) bytes += page_size;
+        }
+    };
+    for ( auto arena : arenas ) {
+        count(arena);
+    }
+    for ( auto arena : freeArenas ) {
+        count(arena);
+    }
+    return bytes;
+}
+
+uint64_t
+MemPool::trim()
+{
+    ThreadCache* cache = getThreadCache();
+
+    // Gather every free element this thread can see
+    std::vector<Magazine*> mags;
+    mags.push_back(cache->loaded);
+    mags.push_back(cache->previous);
+    for ( Magazine* mag = cache->full; mag != nullptr; mag = mag->next ) {
+        mags.push_back(mag);
+    }
+    for ( Magazine* mag = returned.exchange(nullptr, std::memory_order_acquire); mag != nullptr; mag = mag->next ) {
+        mags.push_back(mag);
+    }
+    cache->full = nullptr;
+
+    std::lock_guard<ThreadSafe::Spinlock> lock(arenaLock);
+
+    // Count the free elements in each arena
+    std::vector<uint8_t*> bases(arenas.begin(), arenas.end());
+    std::sort(bases.begin(), bases.end());
+    std::vector<size_t> free_count(bases.size(), 0);
+    auto                arenaIndex = [&](void* item) {
+        return std::upper_bound(bases.begin(), bases.end(), (uint8_t*)item) - bases.begin() - 1;
+    };
+    for ( auto mag : mags ) {
+        for ( size_t i = 0; i < mag->count; ++i ) {
+            free_count[arenaIndex(mag->items[i])]++;
+        }
+    }
+
+    // An arena is free if every element that has been carved out of
+    // it is on one of the lists we gathered
+    uint8_t*          current = arenas.empty() ? nullptr : arenas.back();
+    std::vector<bool> trimmed(bases.size(), false);
+    uint64_t          released = 0;
+    for ( size_t i = 0; i < bases.size(); ++i ) {
+        size_t carved = getArenaElements(bases[i]);
+        if ( carved == 0 || free_count[i] != carved ) continue;
+
+        madvise(bases[i], arenaSize, MADV_DONTNEED);
+        trimmed[i] = true;
+        released += arenaSize;
+        if ( bases[i] == current ) {
+            // Start carving the current arena over from the beginning
+            nextElement = current;
+        }
+        else {
+            arenas.remove(bases[i]);
+            freeArenas.push_back(bases[i]);
+        }
+    }
+
+    // Pack the remaining free elements back into the magazines.  The
+    // write position never passes the read position, so this can be
+    // done in place.
+    size_t out = 0;
+    size_t pos = 0;
+    for ( auto mag : mags ) {
+        size_t count = mag->count;
+        for ( size_t i = 0; i < count; ++i ) {
+            void* item = mag->items[i];
+            if ( trimmed[arenaIndex(item)] ) continue;
+            mags[out]->items[pos++] = item;
+            if ( pos == magazine_size ) {
+                mags[out++]->count = magazine_size;
+                pos                = 0;
+            }
+        }
+    }
+    if ( pos > 0 ) mags[out++]->count = pos;
+
+    // The first two magazines become loaded and previous, even if
+    // they're empty, the rest of the full ones go on the full list
+    for ( size_t i = out; i < mags.size(); ++i ) {
+        mags[i]->count = 0;
+    }
+    cache->loaded   = mags[0];
+    cache->previous = mags[1];
+    for ( size_t i = mags.size() - 1; i >= 2; --i ) {
+        if ( i < out ) {
+            mags[i]->next = cache->full;
+            cache->full   = mags[i];
+        }
+        else {
+            releaseEmptyMagazine(cache, mags[i]);
+        }
+    }
+    cache->loaded->next   = nullptr;
+    cache->previous->next = nullptr;
+
+    return released;
+}
+
+} // namespace Core
+} // namespace SST
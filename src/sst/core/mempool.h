@@ -14,13 +14,16 @@
 
 #include "sst/core/threadsafe.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
-#include <deque>
 #include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include <sys/mman.h>
 
 namespace SST {
@@ -28,136 +31,379 @@ namespace Core {
 
 /**
  * Simple Memory Pool class
+ *
+ * Each thread that uses a pool gets its own cache of free elements,
+ * held in fixed size magazines.  Allocating and freeing only touch
+ * the calling thread's cache.  When a thread fills its magazines with
+ * freed elements, it hands a full magazine back to the pool through
+ * a lock-free list; when a thread runs out, it takes all of the
+ * returned magazines at once, or carves a new batch of elements from
+ * the current arena under a lock.  This keeps elements freed on a
+ * different thread than they were allocated on from contending for
+ * a shared free list.
+ *
+ * Arenas are not touched when they are mapped, so each page is first
+ * touched by the thread that carves elements out of it.  Arenas that
+ * trim() finds completely free are returned to the OS and recycled
+ * the next time the pool needs a new arena.
  */
 class MemPool
 {
-    template <typename LOCK_t>
-    class FreeList
+    // Number of elements held by a single magazine
+    static const size_t magazine_size = 64;
+
+    // Number of empty magazines a thread keeps around before giving
+    // them back to the system
+    static const size_t max_spare_magazines = 16;
+
+    struct Magazine
     {
-        LOCK_t             mtx;
-        std::vector<void*> list;
+        Magazine* next;
+        size_t    count;
+        void*     items[magazine_size];
 
-    public:
-        inline void insert(void* ptr)
+        Magazine() : next(nullptr), count(0) {}
+    };
+
+    // Per thread, per pool state.  Only ever modified by the owning
+    // thread, but the counters may be read by others.
+    struct ThreadCache
+    {
+        Magazine* loaded;
+        Magazine* previous;
+        // Full magazines taken from the pool's returned list
+        Magazine* full;
+        // Empty magazines ready to be reused
+        Magazine* empty;
+        size_t    num_empty;
+
+        std::atomic<uint64_t> num_alloc;
+        std::atomic<uint64_t> num_free;
+
+        ThreadCache() :
+            loaded(new Magazine()),
+            previous(new Magazine()),
+            full(nullptr),
+            empty(nullptr),
+            num_empty(0),
+            num_alloc(0),
+            num_free(0)
+        {}
+
+        ~ThreadCache()
         {
-            std::lock_guard<LOCK_t> lock(mtx);
-            list.push_back(ptr);
+            delete loaded;
+            delete previous;
+            deleteList(full);
+            deleteList(empty);
         }
 
-        inline void* try_remove()
+        // Only the owning thread writes the counters, so they don't
+        // need an atomic read-modify-write
+        inline void countAlloc()
         {
-            std::lock_guard<LOCK_t> lock(mtx);
-            if ( list.empty() ) return nullptr;
-            void* p = list.back();
-            list.pop_back();
-            return p;
+            num_alloc.store(num_alloc.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        inline void countFree()
+        {
+            num_free.store(num_free.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
         }
-
-        size_t size() const { return list.size(); }
     };
 
 public:
+    /** Kind of pages to back arenas with */
+    enum class HugePages {
+        NONE,        /*!< Base pages */
+        TRANSPARENT, /*!< Huge page aligned arenas with MADV_HUGEPAGE */
+        EXPLICIT     /*!< MAP_HUGETLB, falling back to TRANSPARENT if none are available */
+    };
+
     /** Create a new Memory Pool.
      * @param elementSize - Size of each Element
      * @param initialSize - Size of the memory pool (in bytes)
      */
     MemPool(size_t elementSize, size_t initialSize = (2 << 20)) :
-        numAlloc(0),
-        numFree(0),
         elemSize(elementSize),
-        arenaSize(initialSize),
-        allocating(false)
+        arenaSize(huge_pages == HugePages::NONE ? initialSize : roundToHugePage(initialSize)),
+        poolId(next_pool_id++),
+        nextElement(nullptr),
+        arenaEnd(nullptr),
+        returned(nullptr),
+        numMagazines(0)
     {
+        std::lock_guard<ThreadSafe::Spinlock> lock(arenaLock);
         allocPool();
     }
 
     ~MemPool()
     {
+        for ( auto cache : caches ) {
+            delete cache;
+        }
+        deleteList(returned.load());
         for ( std::list<uint8_t*>::iterator i = arenas.begin(); i != arenas.end(); ++i ) {
-            ::free(*i);
+            munmap(*i, arenaSize);
+        }
+        for ( auto arena : freeArenas ) {
+            munmap(arena, arenaSize);
         }
     }
 
+    /** Sets the kind of pages used for arenas mapped from now on */
+    static void setHugePages(HugePages mode) { huge_pages = mode; }
+
     /** Allocate a new element from the memory pool */
     inline void* malloc()
     {
-        void* ret = freeList.try_remove();
-        while ( !ret ) {
-            bool ok = allocPool();
-            if ( !ok ) return nullptr;
-            sst_pause();
-            ret = freeList.try_remove();
+        ThreadCache* cache = getThreadCache();
+        if ( cache->loaded->count == 0 ) {
+            if ( cache->previous->count > 0 ) {
+                std::swap(cache->loaded, cache->previous);
+            }
+            else if ( !refill(cache) ) {
+                return nullptr;
+            }
         }
-        ++numAlloc;
-        return ret;
+        cache->countAlloc();
+        return cache->loaded->items[--cache->loaded->count];
     }
 
     /** Return an element to the memory pool */
     inline void free(void* ptr)
     {
         // TODO:  Make sure this is in one of our arenas
-        freeList.insert(ptr);
+        ThreadCache* cache = getThreadCache();
+        if ( cache->loaded->count == magazine_size ) {
+            if ( cache->previous->count < magazine_size ) {
+                std::swap(cache->loaded, cache->previous);
+            }
+            else {
+                // Both magazines are full, give one back to the pool
+                pushReturned(cache->previous);
+                cache->previous = cache->loaded;
+                cache->loaded   = getEmptyMagazine(cache);
+            }
+        }
+        cache->loaded->items[cache->loaded->count++] = ptr;
+        cache->countFree();
         // #ifdef __SST_DEBUG_EVENT_TRACKING__
         //         *((uint64_t*)ptr) = 0xFFFFFFFFFFFFFFFF;
         // #endif
-        ++numFree;
     }
 
     /**
-       Approximates the current memory usage of the mempool. Some
-       overheads are not taken into account.
+       Approximates the current memory usage of the mempool: the
+       resident part of the arenas plus the magazines. Some overheads
+       are not taken into account.
+     */
+    uint64_t getBytesMemUsed() { return getBytesResident() + numMagazines * sizeof(Magazine); }
+
+    /**
+       Approximates the address space held by the mempool, including
+       arenas that have been trimmed and aren't resident.
      */
-    uint64_t getBytesMemUsed()
+    uint64_t getBytesReserved()
     {
-        uint64_t bytes_in_arenas    = arenas.size() * arenaSize;
-        uint64_t bytes_in_free_list = freeList.size() * sizeof(void*);
-        return bytes_in_arenas + bytes_in_free_list;
+        std::lock_guard<ThreadSafe::Spinlock> lock(arenaLock);
+        return (arenas.size() + freeArenas.size()) * arenaSize + numMagazines * sizeof(Magazine);
     }
 
-    uint64_t getUndeletedEntries() { return numAlloc - numFree; }
+    /**
+       Returns arenas whose elements are all free to the OS.  Only
+       free elements held by the calling thread, or already handed
+       back to the pool, are considered, so this is meant to be
+       called periodically by the thread that allocates from the
+       pool.
+       @return Number of bytes released
+     */
+    uint64_t trim();
+
+    uint64_t getUndeletedEntries() { return getNumAlloc() - getNumFree(); }
 
     /** Counter:  Number of times elements have been allocated */
-    std::atomic<uint64_t> numAlloc;
+    uint64_t getNumAlloc()
+    {
+        std::lock_guard<ThreadSafe::Spinlock> lock(cacheLock);
+        uint64_t                              count = 0;
+        for ( auto cache : caches ) {
+            count += cache->num_alloc.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
     /** Counter:  Number times elements have been freed */
-    std::atomic<uint64_t> numFree;
+    uint64_t getNumFree()
+    {
+        std::lock_guard<ThreadSafe::Spinlock> lock(cacheLock);
+        uint64_t                              count = 0;
+        for ( auto cache : caches ) {
+            count += cache->num_free.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
 
     size_t getArenaSize() const { return arenaSize; }
     size_t getElementSize() const { return elemSize; }
 
+    /** Arenas currently in use.  Trimmed arenas are not included. */
     const std::list<uint8_t*>& getArenas() { return arenas; }
 
+    /** Number of elements that have been handed out from an arena in
+     * use at some point.  Elements past that have never been touched. */
+    size_t getArenaElements(const uint8_t* arena) const
+    {
+        if ( arena == arenas.back() ) return (nextElement - arena) / elemSize;
+        return arenaSize / elemSize;
+    }
+
 private:
-    bool allocPool()
+    static void deleteList(Magazine* list)
     {
-        /* If already in progress, return */
-        if ( allocating.exchange(1, std::memory_order_acquire) ) { return true; }
+        while ( list ) {
+            Magazine* next = list->next;
+            delete list;
+            list = next;
+        }
+    }
 
-        uint8_t* newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-        if ( MAP_FAILED == newPool ) {
-            allocating.store(0, std::memory_order_release);
-            return false;
+    /** Returns the calling thread's cache for this pool */
+    inline ThreadCache* getThreadCache()
+    {
+        if ( poolId < thread_caches.size() && thread_caches[poolId] != nullptr ) return thread_caches[poolId];
+        return createThreadCache();
+    }
+
+    ThreadCache* createThreadCache()
+    {
+        ThreadCache* cache = new ThreadCache();
+        numMagazines += 2;
+        if ( thread_caches.size() <= poolId ) thread_caches.resize(poolId + 1, nullptr);
+        thread_caches[poolId] = cache;
+
+        std::lock_guard<ThreadSafe::Spinlock> lock(cacheLock);
+        caches.push_back(cache);
+        return cache;
+    }
+
+    /** Hands a full magazine back to the pool.  Lock-free; safe to
+     * call from any thread. */
+    inline void pushReturned(Magazine* mag)
+    {
+        Magazine* head = returned.load(std::memory_order_relaxed);
+        do {
+            mag->next = head;
+        } while ( !returned.compare_exchange_weak(head, mag, std::memory_order_release, std::memory_order_relaxed) );
+    }
+
+    Magazine* getEmptyMagazine(ThreadCache* cache)
+    {
+        if ( cache->empty ) {
+            Magazine* mag = cache->empty;
+            cache->empty  = mag->next;
+            cache->num_empty--;
+            mag->next = nullptr;
+            return mag;
+        }
+        numMagazines++;
+        return new Magazine();
+    }
+
+    void releaseEmptyMagazine(ThreadCache* cache, Magazine* mag)
+    {
+        if ( cache->num_empty == max_spare_magazines ) {
+            numMagazines--;
+            delete mag;
+            return;
+        }
+        mag->count   = 0;
+        mag->next    = cache->empty;
+        cache->empty = mag;
+        cache->num_empty++;
+    }
+
+    /** Reloads the calling thread's empty loaded magazine.  Returns
+     * false if no more memory could be allocated. */
+    bool refill(ThreadCache* cache)
+    {
+        // Take every magazine handed back so far.  Taking them all at
+        // once means there is no ABA problem with the lock-free list.
+        if ( cache->full == nullptr ) cache->full = returned.exchange(nullptr, std::memory_order_acquire);
+        if ( cache->full != nullptr ) {
+            Magazine* mag = cache->full;
+            cache->full   = mag->next;
+            mag->next     = nullptr;
+            releaseEmptyMagazine(cache, cache->loaded);
+            cache->loaded = mag;
+            return true;
+        }
+
+        // Carve a batch of new elements out of the arena
+        std::lock_guard<ThreadSafe::Spinlock> lock(arenaLock);
+        Magazine*                             mag = cache->loaded;
+        while ( mag->count < magazine_size ) {
+            if ( nextElement == arenaEnd && !allocPool() ) break;
+            mag->items[mag->count++] = nextElement;
+            nextElement += elemSize;
+        }
+        return mag->count > 0;
+    }
+
+    // Called with arenaLock held
+    bool allocPool()
+    {
+        // Reuse a trimmed arena before mapping a new one.  Anonymous
+        // mappings start out zero filled, so there is no need to
+        // initialize the arena here.
+        uint8_t* newPool = nullptr;
+        if ( !freeArenas.empty() ) {
+            newPool = freeArenas.back();
+            freeArenas.pop_back();
+        }
+        else {
+            newPool = mapArena();
+            if ( nullptr == newPool ) { return false; }
         }
-        std::memset(newPool, 0xFF, arenaSize);
         arenas.push_back(newPool);
-        size_t nelem = arenaSize / elemSize;
-        for ( size_t i = 0; i < nelem; i++ ) {
-            uint64_t* ptr = (uint64_t*)(newPool + (elemSize * i));
-            // #ifdef __SST_DEBUG_EVENT_TRACKING__
-            //             *ptr = 0xFFFFFFFFFFFFFFFF;
-            // #endif
-            freeList.insert(ptr);
-            // freeList.push_back(newPool + (elemSize*i));
-        }
-        allocating.store(0, std::memory_order_release);
+        nextElement = newPool;
+        arenaEnd    = newPool + (arenaSize / elemSize) * elemSize;
         return true;
     }
 
+    uint8_t* mapArena();
+    uint64_t getBytesResident();
+
+    static size_t roundToHugePage(size_t size) { return (size + huge_page_size - 1) / huge_page_size * huge_page_size; }
+
     size_t elemSize;
     size_t arenaSize;
+    size_t poolId;
+
+    // Unused part of the newest arena
+    ThreadSafe::Spinlock arenaLock;
+    uint8_t*             nextElement;
+    uint8_t*             arenaEnd;
+    std::list<uint8_t*>  arenas;
+
+    // Trimmed arenas, still mapped but not resident
+    std::vector<uint8_t*> freeArenas;
+
+    // Full magazines freed by any thread, waiting to be reused
+    std::atomic<Magazine*> returned;
+    std::atomic<uint64_t>  numMagazines;
+
+    // All thread caches for this pool, used for the counters and
+    // cleanup
+    ThreadSafe::Spinlock      cacheLock;
+    std::vector<ThreadCache*> caches;
+
+    static const size_t huge_page_size = 2 << 20;
+    static HugePages    huge_pages;
+
 
-    std::atomic<unsigned int>      allocating;
-    FreeList<ThreadSafe::Spinlock> freeList;
-    std::list<uint8_t*>            arenas;
+    /** Used to give each pool an index into thread_caches */
+    static std::atomic<size_t> next_pool_id;
+    /** The calling thread's cache for each pool, indexed by poolId */
+    static thread_local std::vector<ThreadCache*> thread_caches;
 };
 
 } // namespace Core
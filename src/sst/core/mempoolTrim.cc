@@ -0,0 +1,49 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/mempoolTrim.h"
+
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeConverter.h"
+
+namespace SST {
+
+MemPoolTrim::MemPoolTrim(Simulation_impl* sim, TimeConverter* period) : Action(), m_period(period)
+{
+    sim->insertActivity(period->getFactor(), this);
+}
+
+void
+MemPoolTrim::execute(void)
+{
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+#ifdef USE_MEMPOOL
+    uint64_t released = Activity::trimMemPools();
+    sim->getSimulationOutput().verbose(
+        CALL_INFO, 2, 0, "Trimmed %" PRIu64 " bytes from memory pools on thread %" PRIu32 "\n", released,
+        sim->getRank().thread);
+#endif
+
+    SimTime_t next = sim->getCurrentSimCycle() + m_period->getFactor();
+    sim->insertActivity(next, this);
+}
+
+void
+MemPoolTrim::print(const std::string& header, Output& out) const
+{
+    out.output("%s MemPoolTrim to be delivered at %" PRIu64 "\n", header.c_str(), getDeliveryTime());
+}
+
+} // namespace SST
@@ -0,0 +1,46 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MEMPOOLTRIM_H
+#define SST_CORE_MEMPOOLTRIM_H
+
+#include "sst/core/action.h"
+#include "sst/core/sst_types.h"
+
+namespace SST {
+
+class Simulation_impl;
+class TimeConverter;
+
+/**
+  \class MemPoolTrim
+    Periodically returns fully free memory pool arenas to the OS.  One
+    is created per thread, since each thread trims its own pools.
+*/
+class MemPoolTrim : public Action
+{
+public:
+    MemPoolTrim(Simulation_impl* sim, TimeConverter* period);
+    ~MemPoolTrim() {}
+
+    void print(const std::string& header, Output& out) const override;
+
+private:
+    MemPoolTrim(const MemPoolTrim&);
+    void operator=(MemPoolTrim const&);
+
+    void           execute(void) override;
+    TimeConverter* m_period;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_MEMPOOLTRIM_H
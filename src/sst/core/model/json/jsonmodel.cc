@@ -299,6 +299,13 @@ SSTJSONModelDefinition::discoverGlobalParams(const json& jFile)
 ConfigGraph*
 SSTJSONModelDefinition::createConfigGraph()
 {
+    // A distributed build needs every rank to skip the components it
+    // does not own, which only the python model does
+    if ( config->parallel_load() && config->parallel_load_mode_distributed() ) {
+        output->fatal(CALL_INFO, 1, "JSON model does not support distributed parallel loading\n");
+        return nullptr;
+    }
+
     // open the file
     std::ifstream ifs(scriptName.c_str());
     if ( !ifs.is_open() ) {
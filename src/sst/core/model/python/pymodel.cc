@@ -514,6 +514,8 @@ enableAllStatisticsForComponentName(PyObject* UNUSED(self), PyObject* args)
 
     if ( argOK ) {
         ConfigComponent* cc = gModel->findComponentByName(compName);
+        // Components built by another rank are handled by that rank
+        if ( nullptr == cc && gModel->isDistributedBuild() ) return SST_ConvertToPythonLong(0);
         cc->enableStatistic(STATALLFLAG, pythonToCppParams(statParamDict), apply_to_children);
     }
     else {
@@ -578,7 +580,7 @@ enableStatisticsForComponentName(PyObject* UNUSED(self), PyObject* args)
     if ( argOK ) {
         // Get the component
         ConfigComponent* cc = gModel->findComponentByName(compName);
-        if ( nullptr == cc ) {
+        if ( nullptr == cc && !gModel->isDistributedBuild() ) {
             gModel->getOutput()->fatal(
                 CALL_INFO, 1, "component name not found in call to enableStatisticsForComponentName(): %s\n", compName);
         }
@@ -726,6 +728,7 @@ setStatisticLoadLevelForComponentName(PyObject* UNUSED(self), PyObject* args)
     if ( argOK ) {
         // Get the component
         ConfigComponent* cc = gModel->findComponentByName(compName);
+        if ( nullptr == cc && gModel->isDistributedBuild() ) return SST_ConvertToPythonLong(0);
         if ( nullptr == cc ) {
             gModel->getOutput()->fatal(
                 CALL_INFO, 1, "component name not found in call to setStatisticLoadLevelForComponentName(): %s\n",
@@ -960,7 +963,7 @@ PyInit_sst(void)
 
 void
 SSTPythonModelDefinition::initModel(
-    const std::string& script_file, int verbosity, Config* UNUSED(config), int argc, char** argv)
+    const std::string& script_file, int verbosity, Config* config, int argc, char** argv)
 {
     output = new Output("SSTPythonModel: ", verbosity, 0, SST::Output::STDOUT);
 
@@ -970,6 +973,18 @@ SSTPythonModelDefinition::initModel(
     graph           = new ConfigGraph();
     nextComponentId = 0;
 
+    // In a distributed build, every rank runs the script, but only
+    // builds the components it owns
+    distributed = config->parallel_load() && config->parallel_load_mode_distributed();
+    my_rank     = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( distributed ) {
+        int rank = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        my_rank = rank;
+    }
+#endif
+
     std::string local_script_name;
     int         substr_index = 0;
 
@@ -1260,6 +1275,9 @@ PyObject*
 SST::Core::buildEnabledStatistic(
     ConfigComponent* cc, const char* statName, PyObject* statParamDict, bool apply_to_children)
 {
+    // Statistics on a component built by another rank get a
+    // placeholder so the script can carry on
+    if ( nullptr == cc ) return buildStatisticObject(UNSET_STATISTIC_ID);
     ConfigStatistic* cs = cc->enableStatistic(statName, pythonToCppParams(statParamDict), apply_to_children);
     return buildStatisticObject(cs->id);
 }
@@ -1277,8 +1295,8 @@ SST::Core::buildEnabledStatistics(ConfigComponent* cc, PyObject* statList, PyObj
         PyObject*        pylistitem = PyList_GetItem(statList, x);
         PyObject*        pyname     = PyObject_CallMethod(pylistitem, (char*)"__str__", nullptr);
         std::string      name       = SST_ConvertToCppString(pyname);
-        ConfigStatistic* cs         = cc->enableStatistic(name, params, apply_to_children);
-        PyObject*        statObj    = buildStatisticObject(cs->id);
+        ConfigStatistic* cs         = cc ? cc->enableStatistic(name, params, apply_to_children) : nullptr;
+        PyObject*        statObj    = buildStatisticObject(cs ? cs->id : UNSET_STATISTIC_ID);
         PyList_SetItem(statList, x, statObj);
     }
     return statObjectList;
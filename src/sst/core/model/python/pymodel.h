@@ -71,6 +71,8 @@ protected:
     std::map<std::string, ComponentId_t> compNameMap;
     ComponentId_t                        nextComponentId;
     double                               start_time;
+    bool                                 distributed; /*!< Only build the components this rank owns */
+    uint32_t                             my_rank;
 
 public: /* Public, but private.  Called only from Python functions */
     Config* getConfig(void) const { return config; }
@@ -88,10 +90,36 @@ public: /* Public, but private.  Called only from Python functions */
 
     ComponentId_t addComponent(const char* name, const char* type)
     {
+        // In a distributed build, every rank uses up the id, but only
+        // the owner creates the component
+        if ( distributed ) {
+            if ( !isLocalComponent(graph->getNextComponentId()) ) return graph->reserveComponentId();
+            auto id = graph->addComponent(name, type);
+            graph->findComponent(id)->setRank(getComponentOwner(id));
+            return id;
+        }
         auto id = graph->addComponent(name, type);
         return id;
     }
 
+    bool isDistributedBuild() const { return distributed; }
+
+    /**
+       Rank and thread that build a component in a distributed build.
+       Components are dealt out to each rank and thread in turn in
+       blocks of consecutive ids, so any rank can find the owner of
+       any component from its id.
+    */
+    RankInfo getComponentOwner(ComponentId_t id) const
+    {
+        uint64_t parts = (uint64_t)config->num_ranks() * config->num_threads();
+        uint64_t part  = (COMPONENT_ID_MASK(id) / config->distributed_block_size()) % parts;
+        return RankInfo(part / config->num_threads(), part % config->num_threads());
+    }
+
+    /** Returns true if this rank builds the component */
+    bool isLocalComponent(ComponentId_t id) const { return !distributed || getComponentOwner(id).rank == my_rank; }
+
     ConfigComponent* findComponentByName(const char* name) const
     {
         return graph->findComponentByName(std::string(name));
@@ -103,6 +131,12 @@ public: /* Public, but private.  Called only from Python functions */
     {
         graph->addLink(id, link_name, port, latency, no_cut);
     }
+    void addRemoteLink(
+        ComponentId_t id, const std::string& comp_name, const std::string& comp_type, const char* link_name,
+        const char* port, const char* latency, bool no_cut) const
+    {
+        graph->addRemoteLink(id, comp_name, comp_type, getComponentOwner(id), link_name, port, latency, no_cut);
+    }
     void setLinkNoCut(const char* link_name) const { graph->setLinkNoCut(link_name); }
 
     void  pushNamePrefix(const char* name);
@@ -65,6 +65,18 @@ ComponentHolder::getComp()
     return gModel->getGraph()->findComponent(id);
 }
 
+void
+ComponentHolder::addLink(const char* link_name, const char* port, const char* latency, bool no_cut)
+{
+    gModel->addLink(id, link_name, port, latency, no_cut);
+}
+
+void
+PyRemoteComponent::addLink(const char* link_name, const char* port, const char* latency, bool no_cut)
+{
+    gModel->addRemoteLink(id, top_name, top_type, link_name, port, latency, no_cut);
+}
+
 int
 ComponentHolder::compare(ComponentHolder* other)
 {
@@ -89,11 +101,16 @@ compInit(ComponentPy_t* self, PyObject* args, PyObject* UNUSED(kwds))
     ComponentId_t useID = UNSET_COMPONENT_ID;
     if ( !PyArg_ParseTuple(args, "ss|k", &name, &type, &useID) ) return -1;
 
-    PyComponent* obj;
+    ComponentHolder* obj;
     if ( useID == UNSET_COMPONENT_ID ) {
         char*         prefixed_name = gModel->addNamePrefix(name);
         ComponentId_t id            = gModel->addComponent(prefixed_name, type);
-        obj                         = new PyComponent(self, id);
+        // In a distributed build only the rank that owns a component
+        // creates it in the graph
+        if ( gModel->isLocalComponent(id) ) { obj = new PyComponent(self, id); }
+        else {
+            obj = new PyRemoteComponent(self, id, prefixed_name, type, prefixed_name, type);
+        }
         gModel->getOutput()->verbose(
             CALL_INFO, 3, 0, "Creating component [%s] of type [%s]: id [%" PRIu64 "]\n", name, type, id);
     }
@@ -118,6 +135,7 @@ compAddParam(PyObject* self, PyObject* args)
     char*     param = nullptr;
     PyObject* value = nullptr;
     if ( !PyArg_ParseTuple(args, "sO", &param, &value) ) return nullptr;
+    if ( isRemote(self) ) return SST_ConvertToPythonLong(0);
 
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
@@ -134,29 +152,37 @@ compAddParam(PyObject* self, PyObject* args)
 static PyObject*
 compAddParams(PyObject* self, PyObject* args)
 {
+    if ( isRemote(self) ) return SST_ConvertToPythonLong(0);
+
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
 
     if ( !PyDict_Check(args) ) { return nullptr; }
 
-    Py_ssize_t pos = 0;
-    PyObject * key, *val;
-    long       count = 0;
+    Py_ssize_t                         pos = 0;
+    PyObject *                         key, *val;
+    long                               count = 0;
+    std::map<std::string, std::string> params;
 
     while ( PyDict_Next(args, &pos, &key, &val) ) {
         PyObject* kstr = PyObject_CallMethod(key, (char*)"__str__", nullptr);
         PyObject* vstr = PyObject_CallMethod(val, (char*)"__str__", nullptr);
-        c->addParameter(SST_ConvertToCppString(kstr), SST_ConvertToCppString(vstr), true);
+        params[SST_ConvertToCppString(kstr)] = SST_ConvertToCppString(vstr);
         Py_XDECREF(kstr);
         Py_XDECREF(vstr);
         count++;
     }
+    // Added as one set so that components given the same dict share it
+    c->addParameters(params);
     return SST_ConvertToPythonLong(count);
 }
 
 static PyObject*
 compSetRank(PyObject* self, PyObject* args)
 {
+    // A distributed build places components by their id
+    if ( gModel->isDistributedBuild() ) return SST_ConvertToPythonLong(0);
+
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
 
@@ -175,6 +201,8 @@ compSetRank(PyObject* self, PyObject* args)
 static PyObject*
 compSetWeight(PyObject* self, PyObject* arg)
 {
+    if ( isRemote(self) ) return SST_ConvertToPythonLong(0);
+
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
 
@@ -193,8 +221,7 @@ compSetWeight(PyObject* self, PyObject* arg)
 static PyObject*
 compAddLink(PyObject* self, PyObject* args)
 {
-    ConfigComponent* c  = getComp(self);
-    ComponentId_t    id = c->id;
+    ComponentId_t id = ((ComponentPy_t*)self)->obj->getID();
 
     PyObject* plink = nullptr;
     char *    port = nullptr, *lat = nullptr;
@@ -206,7 +233,7 @@ compAddLink(PyObject* self, PyObject* args)
 
     gModel->getOutput()->verbose(
         CALL_INFO, 4, 0, "Connecting component %" PRIu64 " to Link %s (lat: %s)\n", id, link->name, lat);
-    gModel->addLink(id, link->name, port, lat, link->no_cut);
+    ((ComponentPy_t*)self)->obj->addLink(link->name, port, lat, link->no_cut);
 
     return SST_ConvertToPythonLong(0);
 }
@@ -214,6 +241,7 @@ compAddLink(PyObject* self, PyObject* args)
 static PyObject*
 compGetFullName(PyObject* self, PyObject* UNUSED(args))
 {
+    if ( isRemote(self) ) return SST_ConvertToPythonString(((ComponentPy_t*)self)->obj->getName().c_str());
     return SST_ConvertToPythonString(getComp(self)->getFullName().c_str());
 }
 
@@ -258,6 +286,9 @@ compCompare(PyObject* obj0, PyObject* obj1)
 static PyObject*
 compGetType(PyObject* self, PyObject* UNUSED(args))
 {
+    if ( isRemote(self) ) {
+        return PyUnicode_FromString(static_cast<PyRemoteComponent*>(((ComponentPy_t*)self)->obj)->type.c_str());
+    }
     return PyUnicode_FromString(getComp(self)->type.c_str());
 }
 
@@ -269,6 +300,13 @@ compSetSubComponent(PyObject* self, PyObject* args)
 
     if ( !PyArg_ParseTuple(args, "ss|i", &name, &type, &slot) ) return nullptr;
 
+    if ( isRemote(self) ) {
+        PyObject* argList = Py_BuildValue("Oksis", self, ((ComponentPy_t*)self)->obj->getID(), name, slot, type);
+        PyObject* subObj  = PyObject_CallObject((PyObject*)&PyModel_SubComponentType, argList);
+        Py_DECREF(argList);
+        return subObj;
+    }
+
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
 
@@ -300,10 +338,19 @@ compSetStatistic(PyObject* self, PyObject* args)
     PyObject* statObj;
     char*     name = nullptr;
     if ( !PyArg_ParseTuple(args, "sO", &name, &statObj) ) return nullptr;
+    if ( isRemote(self) ) {
+        Py_INCREF(statObj);
+        return statObj;
+    }
 
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
 
+    if ( isRemoteStat(statObj) ) {
+        PyErr_SetString(PyExc_RuntimeError, "Cannot share a statistic with a component built by another rank");
+        return nullptr;
+    }
+
     ConfigStatistic* s     = getStat(statObj);
     bool             valid = c->reuseStatistic(name, s->id);
     if ( valid ) {
@@ -329,6 +376,7 @@ compEnableStatistic(PyObject* self, PyObject* args)
     PyObject* py_params = nullptr;
 
     if ( !PyArg_ParseTuple(args, "s|O", &name, &py_params) ) { return nullptr; }
+    if ( isRemote(self) ) return buildEnabledStatistic(nullptr, name, py_params, false);
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
 
@@ -363,6 +411,8 @@ error:
         }
     }
 
+    if ( isRemote(self) ) return SST_ConvertToPythonLong(0);
+
     ConfigComponent* c = getComp(self);
     if ( nullptr == c ) return nullptr;
     c->setCoordinates(coords);
@@ -383,6 +433,7 @@ compSetStatisticLoadLevel(PyObject* self, PyObject* args)
     argOK     = PyArg_ParseTuple(args, "i|i", &loadLevel, &apply_to_children);
     loadLevel = loadLevel & 0xff;
 
+    if ( argOK && isRemote(self) ) return SST_ConvertToPythonLong(0);
     if ( argOK ) { c->setStatisticLoadLevel(loadLevel, apply_to_children); }
     else {
         return nullptr;
@@ -411,6 +462,7 @@ compEnableAllStatistics(PyObject* self, PyObject* args)
     // Parse the Python Args and get optional Stat Params (as a Dictionary)
     argOK = PyArg_ParseTuple(args, "|O!i", &PyDict_Type, &statParamDict, &apply_to_children);
 
+    if ( argOK && isRemote(self) ) return SST_ConvertToPythonLong(0);
     if ( argOK ) { c->enableStatistic(STATALLFLAG, pythonToCppParams(statParamDict), apply_to_children); }
     else {
         // ParseTuple Failed, return NULL for error
@@ -435,7 +487,7 @@ compEnableStatistics(PyObject* self, PyObject* args)
     char*            stat_str          = nullptr;
     PyObject*        statParamDict     = nullptr;
     int              apply_to_children = 0;
-    ConfigComponent* cc                = getComp(self);
+    ConfigComponent* cc                = isRemote(self) ? nullptr : getComp(self);
 
     PyErr_Clear();
 
@@ -480,6 +532,7 @@ static PyObject*
 compCreateStatistic(PyObject* self, PyObject* args)
 {
     //    char* param = nullptr;
+    if ( isRemote(self) ) return buildStatisticObject(UNSET_STATISTIC_ID);
     ConfigComponent* comp = getComp(self);
     if ( nullptr == comp ) return nullptr;
 
@@ -514,6 +567,7 @@ compAddGlobalParamSet(PyObject* self, PyObject* arg)
     const char* set = nullptr;
     PyErr_Clear();
     set = SST_ConvertToCppString(arg);
+    if ( set != nullptr && isRemote(self) ) return SST_ConvertToPythonLong(0);
 
     ConfigComponent* c = getComp(self);
 
@@ -619,8 +673,18 @@ subCompInit(ComponentPy_t* self, PyObject* args, PyObject* UNUSED(kwds))
 {
     ComponentId_t id;
     PyObject*     parent;
-    // if ( !PyArg_ParseTuple(args, "Ossii", &parent, &name, &type, &slot, &id) )
-    if ( !PyArg_ParseTuple(args, "Ok", &parent, &id) ) return -1;
+    char *        name = nullptr, *type = nullptr;
+    int           slot = 0;
+    // The name, slot and type are only passed for a subcomponent of a
+    // remote component in a distributed build
+    if ( !PyArg_ParseTuple(args, "Ok|sis", &parent, &id, &name, &slot, &type) ) return -1;
+
+    if ( nullptr != name && isRemote(parent) ) {
+        PyRemoteComponent* remote    = static_cast<PyRemoteComponent*>(((ComponentPy_t*)parent)->obj);
+        std::string        full_name = remote->name + ":" + name + "[" + std::to_string(slot) + "]";
+        self->obj = new PyRemoteComponent(self, id, full_name, type, remote->top_name, remote->top_type);
+        return 0;
+    }
 
     PySubComponent* obj = new PySubComponent(self, id);
 
@@ -42,6 +42,8 @@ struct ComponentHolder
     virtual SST::ConfigComponent* getComp();
     virtual int                   compare(ComponentHolder* other);
     virtual std::string           getName();
+    virtual bool                  isRemote() { return false; }
+    virtual void                  addLink(const char* link_name, const char* port, const char* latency, bool no_cut);
     SST::ComponentId_t            getID();
     SST::ConfigComponent*         getSubComp(const std::string& name, int slot_num);
 };
@@ -61,6 +63,36 @@ struct PySubComponent : ComponentHolder
     int getSlot();
 };
 
+/**
+   A component or subcomponent that another rank builds in a
+   distributed build.  Only what is needed to connect links to it is
+   kept, and everything else done to it is ignored.  The id is that of
+   the top level component, which is all other ranks need to find its
+   rank.
+*/
+struct PyRemoteComponent : ComponentHolder
+{
+    std::string name;     /*!< Full name of this (sub)component */
+    std::string type;     /*!< Type of this (sub)component */
+    std::string top_name; /*!< Name of the top level component */
+    std::string top_type; /*!< Type of the top level component */
+
+    PyRemoteComponent(
+        ComponentPy_t* pobj, SST::ComponentId_t id, const std::string& name, const std::string& type,
+        const std::string& top_name, const std::string& top_type) :
+        ComponentHolder(pobj, id),
+        name(name),
+        type(type),
+        top_name(top_name),
+        top_type(top_type)
+    {}
+    ~PyRemoteComponent() {}
+    SST::ConfigComponent* getComp() override { return nullptr; }
+    std::string           getName() override { return name; }
+    bool                  isRemote() override { return true; }
+    void                  addLink(const char* link_name, const char* port, const char* latency, bool no_cut) override;
+};
+
 struct ComponentPy_t
 {
     PyObject_HEAD ComponentHolder* obj;
@@ -69,6 +101,12 @@ struct ComponentPy_t
 extern PyTypeObject PyModel_ComponentType;
 extern PyTypeObject PyModel_SubComponentType;
 
+static inline bool
+isRemote(PyObject* pobj)
+{
+    return ((ComponentPy_t*)pobj)->obj->isRemote();
+}
+
 static inline SST::ConfigComponent*
 getComp(PyObject* pobj)
 {
@@ -86,15 +86,14 @@ linkConnect(PyObject* self, PyObject* args)
         return nullptr;
     }
 
-    ComponentId_t id0, id1;
-    id0 = getComp(c0)->id;
-    id1 = getComp(c1)->id;
+    ComponentHolder* comp0 = ((ComponentPy_t*)c0)->obj;
+    ComponentHolder* comp1 = ((ComponentPy_t*)c1)->obj;
 
     gModel->getOutput()->verbose(
-        CALL_INFO, 3, 0, "Connecting components %" PRIu64 " and %" PRIu64 " to Link %s (lat: %s %s)\n", id0, id1,
-        ((LinkPy_t*)self)->name, lat0, lat1);
-    gModel->addLink(id0, link->name, port0, lat0, link->no_cut);
-    gModel->addLink(id1, link->name, port1, lat1, link->no_cut);
+        CALL_INFO, 3, 0, "Connecting components %" PRIu64 " and %" PRIu64 " to Link %s (lat: %s %s)\n",
+        comp0->getID(), comp1->getID(), ((LinkPy_t*)self)->name, lat0, lat1);
+    comp0->addLink(link->name, port0, lat0, link->no_cut);
+    comp1->addLink(link->name, port1, lat1, link->no_cut);
 
     return SST_ConvertToPythonLong(0);
 }
@@ -85,6 +85,7 @@ statAddParam(PyObject* self, PyObject* args)
     char*     param = nullptr;
     PyObject* value = nullptr;
     if ( !PyArg_ParseTuple(args, "sO", &param, &value) ) return nullptr;
+    if ( isRemoteStat(self) ) return SST_ConvertToPythonLong(0);
 
     ConfigStatistic* c = getStat(self);
     if ( nullptr == c ) return nullptr;
@@ -101,6 +102,7 @@ statAddParam(PyObject* self, PyObject* args)
 static PyObject*
 statAddParams(PyObject* self, PyObject* args)
 {
+    if ( isRemoteStat(self) ) return SST_ConvertToPythonLong(0);
 
     ConfigStatistic* c = getStat(self);
     if ( nullptr == c ) return nullptr;
@@ -47,6 +47,16 @@ struct StatisticPy_t
 
 extern PyTypeObject PyModel_StatType;
 
+/**
+   Statistics on a component that another rank builds in a distributed
+   build have no ConfigStatistic on this rank
+*/
+static inline bool
+isRemoteStat(PyObject* pobj)
+{
+    return ((StatisticPy_t*)pobj)->obj->id == UNSET_STATISTIC_ID;
+}
+
 static inline ConfigStatistic*
 getStat(PyObject* pobj)
 {
@@ -102,6 +102,8 @@ sgAddComp(PyObject* self, PyObject* args)
     ConfigStatGroup* csg = ((StatGroupPy_t*)self)->ptr;
 
     if ( PyObject_TypeCheck(args, &PyModel_ComponentType) || PyObject_TypeCheck(args, &PyModel_SubComponentType) ) {
+        // Components built by another rank are grouped on that rank
+        if ( isRemote(args) ) return SST_ConvertToPythonLong(0);
         csg->addComponent(((ComponentPy_t*)args)->obj->getID());
     }
     else {
@@ -150,12 +152,24 @@ sgSetFreq(PyObject* self, PyObject* args)
     return SST_ConvertToPythonLong(0);
 }
 
+static PyObject*
+sgSetMerge(PyObject* self, PyObject* args)
+{
+    int merge = PyObject_IsTrue(args);
+    if ( merge < 0 ) { return nullptr; }
+    ((StatGroupPy_t*)self)->ptr->setMerge(merge != 0);
+
+    return SST_ConvertToPythonLong(0);
+}
+
 static PyMethodDef sgMethods[] = {
     { "addStatistic", sgAddStat, METH_VARARGS, "Add a new statistic to the group" },
     { "addComponent", sgAddComp, METH_O, "Add a component to the group" },
     { "setOutput", sgSetOutput, METH_O, "Configure how the stats should be written" },
     { "setFrequency", sgSetFreq, METH_O,
       "Set the frequency or rate (ie: \"10ms\", \"25khz\") to write out the statistics" },
+    { "setMerge", sgSetMerge, METH_O,
+      "Merge each statistic across the group's components and write it out once, named after the group" },
     { nullptr, nullptr, 0, nullptr }
 };
 
@@ -59,6 +59,7 @@ Params::Params() : my_data(), verify_enabled(true)
 
 Params::Params(const Params& old) :
     my_data(old.my_data),
+    shared_data(old.shared_data),
     data(old.data),
     allowedKeys(old.allowedKeys),
     verify_enabled(old.verify_enabled)
@@ -70,6 +71,7 @@ Params&
 Params::operator=(const Params& old)
 {
     my_data        = old.my_data;
+    shared_data    = old.shared_data;
     data           = old.data;
     data[0]        = &my_data;
     verify_enabled = old.verify_enabled;
@@ -81,6 +83,7 @@ void
 Params::clear()
 {
     my_data.clear();
+    shared_data.reset();
     data.clear();
     data.push_back(&my_data);
 }
@@ -99,18 +102,15 @@ Params::count(const key_type& k) const
 void
 Params::print_all_params(std::ostream& os, const std::string& prefix) const
 {
-    int level = 0;
-    for ( auto map : data ) {
-        if ( level == 0 ) {
-            if ( !map->empty() ) os << "Local params:" << std::endl;
-            level++;
-        }
-        else if ( level == 1 ) {
-            os << "Global params:" << std::endl;
-            level++;
-        }
+    auto local = getLocalData();
+    if ( !local.empty() ) os << "Local params:" << std::endl;
+    for ( auto value : local ) {
+        os << "  " << prefix << "key=" << keyMapReverse[value.first] << ", value=" << value.second << std::endl;
+    }
 
-        for ( auto value : *map ) {
+    for ( size_t i = globalsBegin(); i < data.size(); ++i ) {
+        if ( i == globalsBegin() ) os << "Global params:" << std::endl;
+        for ( auto value : *data[i] ) {
             os << "  " << prefix << "key=" << keyMapReverse[value.first] << ", value=" << value.second << std::endl;
         }
     }
@@ -119,18 +119,15 @@ Params::print_all_params(std::ostream& os, const std::string& prefix) const
 void
 Params::print_all_params(Output& out, const std::string& prefix) const
 {
-    int level = 0;
-    for ( auto map : data ) {
-        if ( level == 0 ) {
-            if ( !map->empty() ) out.output("%sLocal params:\n", prefix.c_str());
-            level++;
-        }
-        else if ( level == 1 ) {
-            out.output("%sGlobal params:\n", prefix.c_str());
-            level++;
-        }
+    auto local = getLocalData();
+    if ( !local.empty() ) out.output("%sLocal params:\n", prefix.c_str());
+    for ( auto value : local ) {
+        out.output("%s  %s = %s\n", prefix.c_str(), keyMapReverse[value.first].c_str(), value.second.c_str());
+    }
 
-        for ( auto value : *map ) {
+    for ( size_t i = globalsBegin(); i < data.size(); ++i ) {
+        if ( i == globalsBegin() ) out.output("%sGlobal params:\n", prefix.c_str());
+        for ( auto value : *data[i] ) {
             out.output("%s  %s = %s\n", prefix.c_str(), keyMapReverse[value.first].c_str(), value.second.c_str());
         }
     }
@@ -142,6 +139,7 @@ Params::insert(const std::string& key, const std::string& value, bool overwrite)
     if ( overwrite ) { my_data[getKey(key)] = value; }
     else {
         uint32_t id = getKey(key);
+        if ( shared_data && shared_data->count(id) ) return;
         my_data.insert(std::make_pair(id, value));
     }
 }
@@ -149,8 +147,19 @@ Params::insert(const std::string& key, const std::string& value, bool overwrite)
 void
 Params::insert(const Params& params)
 {
-    my_data.insert(params.my_data.begin(), params.my_data.end());
-    for ( size_t i = 1; i < params.data.size(); ++i ) {
+    if ( my_data.empty() && !shared_data && params.shared_data ) {
+        // Nothing local yet, so the shared set can be shared with this
+        // object too
+        setSharedSet(params.shared_data);
+        my_data.insert(params.my_data.begin(), params.my_data.end());
+    }
+    else {
+        for ( auto& x : params.getLocalData() ) {
+            if ( shared_data && shared_data->count(x.first) ) continue;
+            my_data.insert(x);
+        }
+    }
+    for ( size_t i = params.globalsBegin(); i < params.data.size(); ++i ) {
         bool already_there = false;
         for ( auto x : data ) {
             if ( params.data[i] == x ) already_there = true;
@@ -178,10 +187,14 @@ Params::get_scoped_params(const std::string& scope) const
     ret.enableVerify(false);
 
     std::string prefix = scope + ".";
-    for ( auto map : data ) {
-        for ( auto value : *map ) {
+    for ( size_t i = 0; i < data.size(); ++i ) {
+        // The shared set must not overwrite what my_data overrides
+        bool overwrite = (i != 1 || !shared_data);
+        for ( auto value : *data[i] ) {
             std::string key = keyMapReverse[value.first].substr(0, prefix.length());
-            if ( key == prefix ) { ret.insert(keyMapReverse[value.first].substr(prefix.length()), value.second); }
+            if ( key == prefix ) {
+                ret.insert(keyMapReverse[value.first].substr(prefix.length()), value.second, overwrite);
+            }
         }
     }
     ret.allowedKeys = allowedKeys;
@@ -245,13 +258,40 @@ Params::getParamName(uint32_t id)
 void
 Params::serialize_order(SST::Core::Serialization::serializer& ser)
 {
-    ser&                     my_data;
+    ser& my_data;
+
+    // The shared set is written only the first time it is used in the
+    // message.  After that, only its id is written.
+    uint32_t shared_id = 0;
+    bool     first     = false;
+    switch ( ser.mode() ) {
+    case SST::Core::Serialization::serializer::PACK:
+    case SST::Core::Serialization::serializer::SIZER:
+        if ( shared_data ) shared_id = ser.shared_object_id(shared_data.get(), first);
+        ser& shared_id;
+        if ( first ) ser& const_cast<std::map<uint32_t, std::string>&>(*shared_data);
+        break;
+    case SST::Core::Serialization::serializer::UNPACK:
+        ser& shared_id;
+        if ( shared_id == 0 ) break;
+        if ( auto obj = ser.get_shared_object(shared_id) ) {
+            setSharedSet(std::static_pointer_cast<const std::map<uint32_t, std::string>>(obj));
+        }
+        else {
+            std::map<uint32_t, std::string> set;
+            ser&                            set;
+            setSharedSet(getSharedSet(std::move(set)));
+            ser.add_shared_object(shared_data);
+        }
+        break;
+    }
+
     // Serialize global params
     std::vector<std::string> globals;
     switch ( ser.mode() ) {
     case SST::Core::Serialization::serializer::PACK:
     case SST::Core::Serialization::serializer::SIZER:
-        for ( size_t i = 1; i < data.size(); ++i ) {
+        for ( size_t i = globalsBegin(); i < data.size(); ++i ) {
             globals.push_back((*data[i])[0]);
         }
         ser& globals;
@@ -289,6 +329,67 @@ Params::addGlobalParamSet(const std::string& set)
     data.push_back(&global_params[set]);
 }
 
+void
+Params::insertShared(const std::map<std::string, std::string>& params)
+{
+    if ( !my_data.empty() ) {
+        for ( auto& x : params ) {
+            my_data[getKey(x.first)] = x.second;
+        }
+        return;
+    }
+
+    std::map<uint32_t, std::string> set;
+    if ( shared_data ) set = *shared_data;
+    for ( auto& x : params ) {
+        set[getKey(x.first)] = x.second;
+    }
+    setSharedSet(getSharedSet(std::move(set)));
+}
+
+void
+Params::setSharedSet(const SharedSet_t& set)
+{
+    // The shared set is never written through data
+    auto ptr = const_cast<std::map<uint32_t, std::string>*>(set.get());
+    if ( shared_data )
+        data[1] = ptr;
+    else
+        data.insert(data.begin() + 1, ptr);
+    shared_data = set;
+}
+
+std::map<uint32_t, std::string>
+Params::getLocalData() const
+{
+    if ( !shared_data ) return my_data;
+
+    std::map<uint32_t, std::string> ret(my_data);
+    ret.insert(shared_data->begin(), shared_data->end());
+    return ret;
+}
+
+Params::SharedSet_t
+Params::getSharedSet(std::map<uint32_t, std::string>&& set)
+{
+    size_t hash = 0;
+    for ( auto& x : set ) {
+        hash = hash * 31 + x.first;
+        hash = hash * 31 + std::hash<std::string>()(x.second);
+    }
+
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(sharedLock);
+    auto                                             range = shared_sets.equal_range(hash);
+    for ( auto it = range.first; it != range.second; ++it ) {
+        if ( *it->second == set ) return it->second;
+    }
+    // Shared sets are kept for the life of the simulation, like the
+    // global param sets
+    SharedSet_t ret = std::make_shared<const std::map<uint32_t, std::string>>(std::move(set));
+    shared_sets.insert(std::make_pair(hash, ret));
+    return ret;
+}
+
 void
 Params::insert_global(const std::string& global_key, const std::string& key, const std::string& value, bool overwrite)
 {
@@ -421,8 +522,7 @@ std::vector<std::string>
 Params::getLocalKeys() const
 {
     std::vector<std::string> ret;
-    ret.reserve(data[0]->size());
-    for ( auto x : *data[0] ) {
+    for ( auto x : getLocalData() ) {
         ret.push_back(getParamName(x.first));
     }
     return ret;
@@ -433,9 +533,9 @@ std::vector<std::string>
 Params::getSubscribedGlobalParamSets() const
 {
     std::vector<std::string> ret;
-    ret.reserve((data.size() - 1));
-    // Skip the first item because those are local params
-    for ( size_t i = 1; i < data.size(); ++i ) {
+    ret.reserve((data.size() - globalsBegin()));
+    // Skip the local params
+    for ( size_t i = globalsBegin(); i < data.size(); ++i ) {
         // To get <set_name> key, need to use keyID 0
         ret.push_back((*data[i])[0]);
     }
@@ -511,4 +611,7 @@ bool                            Params::g_verify_enabled = false;
 
 std::map<std::string, std::map<uint32_t, std::string>> Params::global_params;
 
+std::unordered_multimap<size_t, Params::SharedSet_t> Params::shared_sets;
+Core::ThreadSafe::Spinlock                           Params::sharedLock;
+
 } // namespace SST
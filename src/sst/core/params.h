@@ -22,10 +22,12 @@
 #include <inttypes.h>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <stdlib.h>
+#include <unordered_map>
 #include <utility>
 
 int main(int argc, char* argv[]);
@@ -881,6 +883,20 @@ private:
     static void
     insert_global(const std::string& set, const key_type& key, const key_type& value, bool overwrite = true);
 
+    /**
+     * Adds key/value pairs that are likely to be the same for many
+     * Params objects, such as the parameters a model gives to every
+     * component of a type.  While nothing has been inserted locally,
+     * they are merged into this object's shared set.  Shared sets are
+     * immutable and stored once for all Params objects with the same
+     * contents, and later inserts go into the local params, which
+     * override the shared set.  Otherwise the pairs are inserted into
+     * the local params.
+     *
+     * @param params key/value pairs to add, overwriting existing pairs
+     */
+    void insertShared(const std::map<std::string, std::string>& params);
+
     /**
      * Get a named global parameter set.
      *
@@ -928,8 +944,27 @@ private:
     void verifyKey(const key_type& k) const;
 
 
+    typedef std::shared_ptr<const std::map<uint32_t, std::string>> SharedSet_t;
+
+    /** Sets the shared set, which is searched right after my_data */
+    void setSharedSet(const SharedSet_t& set);
+
+    /** Index of the first global param set in data */
+    size_t globalsBegin() const { return shared_data ? 2 : 1; }
+
+    /** Returns the local params, with my_data taking precedence over
+     * the shared set */
+    std::map<uint32_t, std::string> getLocalData() const;
+
+    /**
+     * Returns the shared set with the given contents, creating it if
+     * no Params object has used those contents yet
+     */
+    static SharedSet_t getSharedSet(std::map<uint32_t, std::string>&& set);
+
     // Private data
     std::map<uint32_t, std::string>               my_data;
+    SharedSet_t                                   shared_data;
     std::vector<std::map<uint32_t, std::string>*> data;
     std::vector<KeySet_t>                         allowedKeys;
     bool                                          verify_enabled;
@@ -954,6 +989,10 @@ private:
     static uint32_t                        nextKeyID;
 
     static std::map<std::string, std::map<uint32_t, std::string>> global_params;
+
+    // Shared sets by a hash of their contents
+    static std::unordered_multimap<size_t, SharedSet_t> shared_sets;
+    static SST::Core::ThreadSafe::Spinlock              sharedLock;
 };
 
 #if 0
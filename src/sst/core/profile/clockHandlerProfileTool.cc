@@ -66,6 +66,37 @@ ClockHandlerProfileTool::getKeyForHandler(const HandlerMetaData& mdata)
     return key;
 }
 
+uintptr_t
+ClockHandlerProfileTool::registerClock(SimTime_t period, int priority)
+{
+    return reinterpret_cast<uintptr_t>(&clock_stats_[std::make_pair(period, priority)]);
+}
+
+void
+ClockHandlerProfileTool::clockEnd(uintptr_t key, uint64_t handlers)
+{
+    clock_stats_t* entry = reinterpret_cast<clock_stats_t*>(key);
+    entry->ticks++;
+    entry->handlers += handlers;
+}
+
+void
+ClockHandlerProfileTool::outputClockData(FILE* fp, bool timed)
+{
+    if ( clock_stats_.empty() ) return;
+    if ( timed )
+        fprintf(fp, "Clock period, priority, ticks, handler calls, avg. handlers per tick, clock time (s)\n");
+    else
+        fprintf(fp, "Clock period, priority, ticks, handler calls, avg. handlers per tick\n");
+    for ( auto& x : clock_stats_ ) {
+        fprintf(
+            fp, "%" PRIu64 ", %d, %" PRIu64 ", %" PRIu64 ", %lf", x.first.first, x.first.second, x.second.ticks,
+            x.second.handlers, x.second.ticks == 0 ? 0.0 : ((double)x.second.handlers) / x.second.ticks);
+        if ( timed ) fprintf(fp, ", %lf", ((double)x.second.time) / 1000000000.0);
+        fprintf(fp, "\n");
+    }
+}
+
 ClockHandlerProfileToolCount::ClockHandlerProfileToolCount(
     ProfileToolId_t id, const std::string& name, Params& params) :
     ClockHandlerProfileTool(id, name, params)
@@ -92,6 +123,7 @@ ClockHandlerProfileToolCount::outputData(FILE* fp)
     for ( auto& x : counts_ ) {
         fprintf(fp, "%s, %" PRIu64 "\n", x.first.c_str(), x.second);
     }
+    outputClockData(fp, false);
 }
 
 
@@ -119,6 +151,7 @@ ClockHandlerProfileToolTime<T>::outputData(FILE* fp)
             fp, "%s, %" PRIu64 ", %lf, %" PRIu64 "\n", x.first.c_str(), x.second.count,
             ((double)x.second.time) / 1000000000.0, x.second.count == 0 ? 0 : x.second.time / x.second.count);
     }
+    outputClockData(fp, true);
 }
 
 
@@ -39,10 +39,39 @@ public:
 
     ClockHandlerProfileTool(ProfileToolId_t id, const std::string& name, Params& params);
 
+    /**
+       Register a Clock to collect per clock statistics for.  Returns
+       the key to pass to clockStart() and clockEnd().
+     */
+    uintptr_t registerClock(SimTime_t period, int priority);
+
+    /** Called before a Clock calls its handlers */
+    virtual void clockStart(uintptr_t UNUSED(key)) {}
+
+    /** Called after a Clock has called its handlers.
+        @param handlers Number of handlers called on this tick
+     */
+    virtual void clockEnd(uintptr_t key, uint64_t handlers);
+
 protected:
+    struct clock_stats_t
+    {
+        uint64_t ticks;
+        uint64_t handlers;
+        uint64_t time;
+
+        clock_stats_t() : ticks(0), handlers(0), time(0) {}
+    };
+
     std::string getKeyForHandler(const HandlerMetaData& mdata);
 
+    /** Writes the per clock statistics */
+    void outputClockData(FILE* fp, bool timed);
+
     Profile_Level profile_level_;
+
+    // Keyed by clock period and priority
+    std::map<std::pair<SimTime_t, int>, clock_stats_t> clock_stats_;
 };
 
 
@@ -108,10 +137,21 @@ public:
         entry->count++;
     }
 
+    void clockStart(uintptr_t UNUSED(key)) override { clock_start_time_ = T::now(); }
+
+    void clockEnd(uintptr_t key, uint64_t handlers) override
+    {
+        auto           total_time = T::now() - clock_start_time_;
+        clock_stats_t* entry      = reinterpret_cast<clock_stats_t*>(key);
+        entry->time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        ClockHandlerProfileTool::clockEnd(key, handlers);
+    }
+
     void outputData(FILE* fp) override;
 
 private:
     typename T::time_point              start_time_;
+    typename T::time_point              clock_start_time_;
     std::map<std::string, clock_data_t> times_;
 };
 
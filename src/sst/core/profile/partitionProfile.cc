@@ -0,0 +1,245 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/profile/partitionProfile.h"
+
+#include "sst/core/configGraph.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+namespace SST {
+namespace Profile {
+
+namespace {
+
+// Smallest weight given to a profiled component or link, so that idle
+// components and links are not entirely free to move or cut
+const double MIN_WEIGHT = 0.01;
+
+std::string
+trim(const std::string& str)
+{
+    auto start = str.find_first_not_of(" \t\r");
+    if ( start == std::string::npos ) return "";
+    auto end = str.find_last_not_of(" \t\r");
+    return str.substr(start, end - start + 1);
+}
+
+// Split a table row into its name and the values of the remaining
+// columns.  The values are taken from the right so that a comma in the
+// name does not shift the columns.
+bool
+splitRow(const std::string& line, size_t num_values, std::string& name, std::vector<std::string>& values)
+{
+    values.assign(num_values, "");
+    size_t end = line.size();
+    for ( size_t i = num_values; i > 0; --i ) {
+        if ( end == 0 ) return false;
+        auto comma = line.rfind(',', end - 1);
+        if ( comma == std::string::npos ) return false;
+        values[i - 1] = trim(line.substr(comma + 1, end - comma - 1));
+        end           = comma;
+    }
+    name = trim(line.substr(0, end));
+    return !name.empty();
+}
+
+bool
+toDouble(const std::string& str, double& value)
+{
+    if ( str.empty() ) return false;
+    char* end;
+    value = std::strtod(str.c_str(), &end);
+    return *end == '\0';
+}
+
+bool
+toCount(const std::string& str, uint64_t& value)
+{
+    if ( str.empty() || str[0] == '-' ) return false;
+    char* end;
+    value = std::strtoull(str.c_str(), &end, 10);
+    return *end == '\0';
+}
+
+// Sums values by the top level component they belong to.  Returns the
+// total of the values that matched a component in the graph.
+template <typename T>
+double
+findLoad(ConfigGraph* graph, const std::map<std::string, T>& values, std::map<ComponentId_t, double>& load)
+{
+    double total = 0.0;
+    for ( auto& x : values ) {
+        ConfigComponent* comp = graph->findComponentByName(x.first);
+        if ( nullptr == comp ) continue;
+        load[comp->id] += static_cast<double>(x.second);
+        total += static_cast<double>(x.second);
+    }
+    return total;
+}
+
+// Name of a component as the profile tools see it.  This follows the
+// naming in ComponentInfo, which only adds the slot number when a slot
+// holds more than one subcomponent.
+std::string
+runtimeName(const ConfigComponent* comp)
+{
+    if ( comp->id == COMPONENT_ID_MASK(comp->id) ) return comp->name;
+
+    const ConfigComponent* parent = comp->getParent();
+    std::string            name   = runtimeName(parent) + ":" + comp->name;
+    int                    count  = 0;
+    for ( auto sc : parent->subComponents ) {
+        if ( sc->name == comp->name ) count++;
+    }
+    if ( count > 1 ) name += "[" + std::to_string(comp->slot_num) + "]";
+    return name;
+}
+
+} // anonymous namespace
+
+bool
+PartitionProfile::load(const std::string& file)
+{
+    std::ifstream in(file);
+    if ( in.is_open() ) {
+        parse(in);
+        return true;
+    }
+
+    // Each rank of a parallel run writes its own file with the rank
+    // added before the extension
+    auto        index = file.find_last_of(".");
+    std::string base  = file.substr(0, index);
+    std::string ext   = index == std::string::npos ? "" : file.substr(index);
+
+    bool found = false;
+    for ( int rank = 0;; ++rank ) {
+        std::ifstream rank_in(base + std::to_string(rank) + ext);
+        if ( !rank_in.is_open() ) break;
+        parse(rank_in);
+        found = true;
+    }
+    return found;
+}
+
+void
+PartitionProfile::parse(std::istream& in)
+{
+    // Columns of the handler table currently being read.  Empty when
+    // not in a table.
+    std::vector<std::string> columns;
+    int                      count_col = -1;
+    int                      time_col  = -1;
+
+    std::string              line;
+    std::string              name;
+    std::vector<std::string> values;
+    while ( std::getline(in, line) ) {
+        // Handler tables all start with a "Name, ..." header
+        if ( line.compare(0, 4, "Name") == 0 && (line.size() == 4 || line[4] == ',') ) {
+            splitRow(line, std::count(line.begin(), line.end(), ','), name, columns);
+            count_col = -1;
+            time_col  = -1;
+            for ( size_t i = 0; i < columns.size(); ++i ) {
+                if ( columns[i] == "recv count" || columns[i] == "count" ) count_col = i;
+                if ( columns[i] == "recv time (s)" || columns[i] == "handler time (s)" ) time_col = i;
+            }
+            continue;
+        }
+        if ( columns.empty() ) continue;
+
+        // Anything that is not a row of numbers ends the table, which
+        // is a blank line or the header of another table
+        uint64_t count = 0;
+        double   time  = 0.0;
+        if ( !splitRow(line, columns.size(), name, values) ||
+             (count_col != -1 && !toCount(values[count_col], count)) ||
+             (time_col != -1 && !toDouble(values[time_col], time)) ) {
+            columns.clear();
+            continue;
+        }
+
+        std::string comp_name = name.substr(0, name.find(":"));
+        if ( count_col != -1 ) {
+            comp_count_[comp_name] += count;
+            port_count_[name] += count;
+        }
+        if ( time_col != -1 ) comp_time_[comp_name] += time;
+    }
+}
+
+size_t
+PartitionProfile::setComponentWeights(ConfigGraph* graph)
+{
+    // Handler time is the better measure of load, but use the number
+    // of handler calls if no time was recorded
+    std::map<ComponentId_t, double> load;
+    double                          total = findLoad(graph, comp_time_, load);
+    if ( total <= 0.0 ) {
+        load.clear();
+        total = findLoad(graph, comp_count_, load);
+    }
+    if ( total <= 0.0 ) return 0;
+
+    double mean = total / load.size();
+    for ( auto& x : load ) {
+        graph->findComponent(x.first)->weight = std::max(MIN_WEIGHT, x.second / mean);
+    }
+    return load.size();
+}
+
+size_t
+PartitionProfile::setLinkWeights(ConfigGraph* graph, PartitionGraph* pgraph)
+{
+    if ( port_count_.empty() ) return 0;
+
+    ConfigLinkMap_t&           links = graph->getLinkMap();
+    std::map<LinkId_t, double> events;
+    double                     total = 0.0;
+    for ( auto& plink : pgraph->getLinkMap() ) {
+        const ConfigLink* link  = links[plink.id];
+        bool              found = false;
+        double            count = 0.0;
+        for ( int i = 0; i < 2; ++i ) {
+            // Ports are tracked under the subcomponent name or under
+            // the top level component name, depending on the profile
+            // level
+            const ConfigComponent* comp = graph->findComponent(link->component[i]);
+            auto                   it   = port_count_.find(runtimeName(comp) + ":" + link->port[i].str());
+            if ( it == port_count_.end() ) {
+                const ConfigComponent* top = graph->findComponent(COMPONENT_ID_MASK(link->component[i]));
+                it                         = port_count_.find(top->name + ":" + link->port[i].str());
+            }
+            if ( it == port_count_.end() ) continue;
+            found = true;
+            count += static_cast<double>(it->second);
+        }
+        if ( !found ) continue;
+        events[plink.id] = count;
+        total += count;
+    }
+    if ( total <= 0.0 ) return 0;
+
+    double mean = total / events.size();
+    for ( auto& x : events ) {
+        pgraph->getLinkMap()[x.first].weight = std::max(MIN_WEIGHT, x.second / mean);
+    }
+    return events.size();
+}
+
+} // namespace Profile
+} // namespace SST
@@ -0,0 +1,80 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_PROFILE_PARTITIONPROFILE_H
+#define SST_CORE_PROFILE_PARTITIONPROFILE_H
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <string>
+
+namespace SST {
+
+class ConfigGraph;
+class PartitionGraph;
+
+namespace Profile {
+
+/**
+   Partitioning weights taken from the profiling output of an earlier
+   run (see --profiling-output).  Time spent in clock and event
+   handlers becomes the weight of each component, or the number of
+   handler calls when only counting tools were used.  Events received
+   on the ports at each end of a link become the weight of the link;
+   this requires an event handler tool with track_ports=true at the
+   component or subcomponent level.
+*/
+class PartitionProfile
+{
+public:
+    PartitionProfile() {}
+
+    /**
+       Read the profiling output.  If the file does not exist, the
+       files written by each rank of a parallel run are read instead.
+
+       @param file Profiling output of the earlier run
+       @return true if any profiling output was read
+    */
+    bool load(const std::string& file);
+
+    /**
+       Set the weight of each component in the graph from the profile.
+       Weights are normalized so that the average profiled component
+       has a weight of 1.  Components missing from the profile keep
+       their configured weight.
+
+       @return number of components found in the profile
+    */
+    size_t setComponentWeights(ConfigGraph* graph);
+
+    /**
+       Set the weight of each link in the partition graph from the
+       events received at both of its ends, normalized the same way as
+       the component weights.
+
+       @return number of links found in the profile
+    */
+    size_t setLinkWeights(ConfigGraph* graph, PartitionGraph* pgraph);
+
+private:
+    void parse(std::istream& in);
+
+    std::map<std::string, double>   comp_time_;  /*!< Handler time (s) by top level component */
+    std::map<std::string, uint64_t> comp_count_; /*!< Handler calls by top level component */
+    std::map<std::string, uint64_t> port_count_; /*!< Events received by profile key */
+};
+
+} // namespace Profile
+} // namespace SST
+
+#endif // SST_CORE_PROFILE_PARTITIONPROFILE_H
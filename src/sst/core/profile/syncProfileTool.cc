@@ -42,6 +42,7 @@ SyncProfileToolCount::outputData(FILE* fp)
 {
     fprintf(fp, "%s (id = %" PRIu64 ")\n", name.c_str(), my_id);
     fprintf(fp, "  SyncManager Count = %" PRIu64 "\n", syncmanager_count);
+    fprintf(fp, "  Barrier Count = %" PRIu64 "\n", barrier_count);
 }
 
 
@@ -58,6 +59,7 @@ SyncProfileToolTime<T>::outputData(FILE* fp)
     fprintf(fp, "  SyncManager Count = %" PRIu64 "\n", syncmanager_count);
     fprintf(fp, "  Total SyncManager Time = %lfs\n", (float)syncmanager_time / 1000000000.0);
     fprintf(fp, "  Average SyncManager Time = %" PRIu64 "ns\n", syncmanager_time / syncmanager_count);
+    fprintf(fp, "  Barrier Count = %" PRIu64 "\n", barrier_count);
 }
 
 
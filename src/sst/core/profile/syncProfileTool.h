@@ -40,6 +40,10 @@ public:
 
     virtual void syncManagerStart() {}
     virtual void syncManagerEnd() {}
+
+    /** Called before syncManagerEnd() with the number of barriers
+     * the SyncManager waited on during this sync */
+    virtual void syncManagerBarriers(uint32_t UNUSED(count)) {}
 };
 
 
@@ -66,10 +70,13 @@ public:
 
     void syncManagerStart() override;
 
+    void syncManagerBarriers(uint32_t count) override { barrier_count += count; }
+
     void outputData(FILE* fp) override;
 
 private:
     uint64_t syncmanager_count = 0;
+    uint64_t barrier_count     = 0;
 };
 
 /**
@@ -93,11 +100,14 @@ public:
         syncmanager_count++;
     }
 
+    void syncManagerBarriers(uint32_t count) override { barrier_count += count; }
+
     void outputData(FILE* fp) override;
 
 private:
     uint64_t syncmanager_time  = 0;
     uint64_t syncmanager_count = 0;
+    uint64_t barrier_count     = 0;
 
     typename T::time_point start_time_;
 };
@@ -245,11 +245,9 @@ template <class T>
 const uint32_t serializable_builder_impl<T>::cls_id_ =
     serializable_factory::add_builder(new serializable_builder_impl<T>, typeid(T).name());
 
-// Hold off on trivially_serializable for now, as it's not really safe
+// trivially_serializable is a trait that is set per type (see
+// serialize.h) rather than a base class, since a base class isn't safe
 // in the case of inheritance
-//
-// class trivially_serializable {
-// };
 
 } // namespace Serialization
 } // namespace Core
@@ -16,6 +16,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <iostream>
+#include <type_traits>
 #include <typeinfo>
 
 namespace SST {
@@ -46,6 +47,34 @@ public:
     }
 };
 
+/**
+   Trait used to opt a trivially copyable type into being serialized
+   with a single bulk copy of its bytes instead of member by member.
+   Use ImplementTriviallySerializable(type) to set it.  Classes
+   derived from serializable (including Events) are polymorphic and
+   can't use this directly, but can keep their data in a struct that
+   does and serialize that struct as a single member.
+ */
+template <class T>
+struct trivially_serializable : std::false_type
+{};
+
+namespace pvt {
+
+/**
+   Types whose values can be serialized as a contiguous block of
+   bytes, which lets containers of them use a single bulk copy.  bool
+   is excluded because it is serialized as an int.
+ */
+template <class T>
+struct bulk_serializable :
+    std::integral_constant<
+        bool, (std::is_fundamental<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value ||
+                  trivially_serializable<T>::value>
+{};
+
+} // namespace pvt
+
 /**
    Version of serialize that works for fundamental types and enums.
  */
@@ -66,6 +95,18 @@ public:
 //     }
 // };
 
+/**
+   Version of serialize that works for types marked with
+   ImplementTriviallySerializable.  The whole object is copied in one
+   operation.
+ */
+template <class T>
+class serialize<T, typename std::enable_if<trivially_serializable<T>::value>::type>
+{
+public:
+    inline void operator()(T& t, serializer& ser) { ser.primitive(t); }
+};
+
 /**
    Version of serialize that works for bool.
  */
@@ -134,6 +175,26 @@ operator&(serializer& ser, T& t)
 } // namespace Core
 } // namespace SST
 
+/**
+   Mark a trivially copyable type so it is serialized with a single
+   bulk copy (see trivially_serializable).  Must be used at global
+   scope with the fully qualified name of the type.  The bytes are
+   copied as is, so the type can't hold pointers and both sides of a
+   transfer need the same layout.
+ */
+#define ImplementTriviallySerializable(obj)                                                                  \
+    namespace SST {                                                                                          \
+    namespace Core {                                                                                         \
+    namespace Serialization {                                                                                \
+    template <>                                                                                              \
+    struct trivially_serializable<obj> : std::true_type                                                      \
+    {                                                                                                        \
+        static_assert(std::is_trivially_copyable<obj>::value, #obj " must be trivially copyable");           \
+    };                                                                                                       \
+    }                                                                                                        \
+    }                                                                                                        \
+    }
+
 #include "sst/core/serialization/serialize_array.h"
 #include "sst/core/serialization/serialize_deque.h"
 #include "sst/core/serialization/serialize_list.h"
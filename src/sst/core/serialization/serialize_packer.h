@@ -24,13 +24,50 @@ namespace pvt {
 class ser_packer : public ser_buffer_accessor
 {
 public:
+    ser_packer() : ser_buffer_accessor(), growable_(false) {}
+
     template <class T>
     void pack(T& t)
     {
-        T* buf = ser_buffer_accessor::next<T>();
+        T* buf = next<T>();
         *buf   = t;
     }
 
+    template <class T>
+    T* next()
+    {
+        if ( growable_ ) reserve(sizeof(T));
+        return ser_buffer_accessor::next<T>();
+    }
+
+    char* next_str(size_t size)
+    {
+        if ( growable_ ) reserve(size);
+        return ser_buffer_accessor::next_str(size);
+    }
+
+    void init(void* buffer, size_t size)
+    {
+        growable_ = false;
+        ser_buffer_accessor::init(buffer, size);
+    }
+
+    /**
+     * Pack into a buffer that is replaced with a larger one when it
+     * fills up.  The packer owns the buffer until packing is done,
+     * then the (possibly new) buffer is returned by buffer().
+     * @param buf  Buffer allocated with new char[], or nullptr
+     * @param size Size of buf
+     */
+    void init_growable(char* buf, size_t size)
+    {
+        growable_ = true;
+        ser_buffer_accessor::init(buf, size);
+    }
+
+    /** Start of the buffer being packed into */
+    char* buffer() const { return bufstart_; }
+
     /**
      * @brief pack_buffer
      * @param buf  Must be non-null
@@ -39,6 +76,16 @@ public:
     void pack_buffer(void* buf, int size);
 
     void pack_string(std::string& str);
+
+private:
+    void reserve(size_t size)
+    {
+        if ( size_ + size > max_size_ ) grow(size_ + size);
+    }
+
+    void grow(size_t needed);
+
+    bool growable_;
 };
 
 } // namespace pvt
@@ -107,17 +107,6 @@ public:
     }
 };
 
-// Hold off on trivially_serializable for now, as it's not really safe
-// in the case of inheritance
-//
-// template <class T>
-// class serialize <T, typename
-// std::enable_if<std::is_base_of<SST::Core::Serialization::trivially_serializable,T>::value>::type> { public:
-//     inline void operator()(T& t, serializer& ser){
-//         ser.primitive(t);
-//     }
-// };
-
 } // namespace Serialization
 } // namespace Core
 } // namespace SST
@@ -21,7 +21,7 @@ namespace Core {
 namespace Serialization {
 
 template <class T>
-class serialize<std::vector<T>>
+class serialize<std::vector<T>, typename std::enable_if<!pvt::bulk_serializable<T>::value>::type>
 {
     typedef std::vector<T> Vector;
 
@@ -56,6 +56,47 @@ public:
     }
 };
 
+/**
+   Version of serialize for vectors of fundamental types, enums and
+   trivially serializable types.  The elements are copied in one
+   block, which produces the same bytes as serializing them one at a
+   time.
+ */
+template <class T>
+class serialize<std::vector<T>, typename std::enable_if<pvt::bulk_serializable<T>::value>::type>
+{
+    typedef std::vector<T> Vector;
+
+public:
+    void operator()(Vector& v, serializer& ser)
+    {
+        switch ( ser.mode() ) {
+        case serializer::SIZER:
+        {
+            size_t size = v.size();
+            ser.size(size);
+            ser.sizer().add(size * sizeof(T));
+            break;
+        }
+        case serializer::PACK:
+        {
+            size_t size = v.size();
+            ser.pack(size);
+            if ( size != 0 ) ::memcpy(ser.packer().next_str(size * sizeof(T)), v.data(), size * sizeof(T));
+            break;
+        }
+        case serializer::UNPACK:
+        {
+            size_t s;
+            ser.unpack(s);
+            v.resize(s);
+            if ( s != 0 ) ::memcpy(v.data(), ser.unpacker().next_str(s * sizeof(T)), s * sizeof(T));
+            break;
+        }
+        }
+    }
+};
+
 } // namespace Serialization
 } // namespace Core
 } // namespace SST
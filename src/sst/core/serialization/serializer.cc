@@ -46,6 +46,22 @@ ser_packer::pack_buffer(void* buf, int size)
     ::memcpy(charstr, buf, size);
 }
 
+void
+ser_packer::grow(size_t needed)
+{
+    // Double the size so that repeated growth is amortized
+    size_t new_size = max_size_ * 2;
+    if ( new_size < needed ) new_size = needed;
+
+    char* new_buf = new char[new_size];
+    if ( size_ != 0 ) ::memcpy(new_buf, bufstart_, size_);
+    delete[] bufstart_;
+
+    bufstart_ = new_buf;
+    bufptr_   = new_buf + size_;
+    max_size_ = new_size;
+}
+
 void
 ser_unpacker::unpack_string(std::string& str)
 {
@@ -96,6 +112,14 @@ serializer::string(std::string& str)
     }
 }
 
+uint32_t
+serializer::shared_object_id(const void* obj, bool& first)
+{
+    auto ret = shared_ids_.insert(std::make_pair(obj, (uint32_t)shared_ids_.size() + 1));
+    first    = ret.second;
+    return ret.first->second;
+}
+
 } // namespace Serialization
 } // namespace Core
 } // namespace SST
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <typeinfo>
 #include <vector>
@@ -37,7 +38,7 @@ public:
     typedef enum { SIZER, PACK, UNPACK } SERIALIZE_MODE;
 
 public:
-    serializer() : mode_(SIZER) // just sizing by default
+    serializer() : mode_(SIZER), skip_activity_header_(false) // just sizing by default
     {}
 
     pvt::ser_packer& packer() { return packer_; }
@@ -71,11 +72,40 @@ public:
 
     void set_mode(SERIALIZE_MODE mode) { mode_ = mode; }
 
+    /** When set, the next Event leaves its delivery fields (delivery
+     * time, priority, queue order and delivery info) out of the
+     * stream.  Event::serialize_order() clears the flag before the
+     * event's own data, so it has to be set again before each event.
+     * Used when the caller sends those fields itself, such as the
+     * batched format in SyncQueue. */
+    void set_skip_activity_header(bool skip) { skip_activity_header_ = skip; }
+
+    bool skip_activity_header() const { return skip_activity_header_; }
+
+    /** Objects that many serialized objects point to, such as shared
+     * Params sets, are only written the first time they appear in a
+     * message.  Returns the id of obj in this message and sets first
+     * if obj has not been written yet.  Ids start at 1. */
+    uint32_t shared_object_id(const void* obj, bool& first);
+
+    /** Records a shared object read while unpacking.  It gets the next
+     * id, matching the order the objects were written in. */
+    void add_shared_object(std::shared_ptr<const void> obj) { unpacked_shared_.push_back(std::move(obj)); }
+
+    /** Returns the shared object read earlier in this message with the
+     * given id, or nullptr if it has not been read yet */
+    std::shared_ptr<const void> get_shared_object(uint32_t id) const
+    {
+        if ( id == 0 || id > unpacked_shared_.size() ) return nullptr;
+        return unpacked_shared_[id - 1];
+    }
+
     void reset()
     {
         sizer_.reset();
         packer_.reset();
         unpacker_.reset();
+        clear_shared_objects();
     }
 
     template <typename T>
@@ -168,18 +198,31 @@ public:
     {
         packer_.init(buffer, size);
         mode_ = PACK;
+        clear_shared_objects();
+    }
+
+    /** Start packing into a buffer that grows as needed, so the data
+     * doesn't need to be sized first.  See ser_packer::init_growable()
+     * for the buffer ownership rules. */
+    void start_packing_growable(char* buffer, size_t size)
+    {
+        packer_.init_growable(buffer, size);
+        mode_ = PACK;
+        clear_shared_objects();
     }
 
     void start_sizing()
     {
         sizer_.reset();
         mode_ = SIZER;
+        clear_shared_objects();
     }
 
     void start_unpacking(char* buffer, size_t size)
     {
         unpacker_.init(buffer, size);
         mode_ = UNPACK;
+        clear_shared_objects();
     }
 
     size_t size() const
@@ -196,12 +239,24 @@ public:
     }
 
 protected:
+    void clear_shared_objects()
+    {
+        shared_ids_.clear();
+        unpacked_shared_.clear();
+    }
+
     // only one of these is going to be valid for this spkt_serializer
     // not very good class design, but a little more convenient
     pvt::ser_packer   packer_;
     pvt::ser_unpacker unpacker_;
     pvt::ser_sizer    sizer_;
     SERIALIZE_MODE    mode_;
+    bool              skip_activity_header_;
+
+    // Shared objects already written (SIZER and PACK) or read (UNPACK)
+    // in the current message
+    std::map<const void*, uint32_t>          shared_ids_;
+    std::vector<std::shared_ptr<const void>> unpacked_shared_;
 };
 
 } // namespace Serialization
@@ -22,6 +22,7 @@
 #include "sst/core/heartbeat.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/linkPair.h"
+#include "sst/core/mempoolTrim.h"
 #include "sst/core/output.h"
 #include "sst/core/profile/clockHandlerProfileTool.h"
 #include "sst/core/profile/eventHandlerProfileTool.h"
@@ -208,7 +209,14 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
     output_directory = cfg->output_directory();
     Params p;
     // params get passed twice - both the params and a ctor argument
-    direct_interthread = cfg->interthread_links();
+    direct_interthread      = cfg->interthread_links();
+    rank_sync_type          = cfg->rank_sync();
+    adaptive_lookahead      = cfg->adaptive_lookahead();
+    thread_sync_type        = cfg->thread_sync();
+    rank_sync_compression   = cfg->rank_sync_compression();
+    async_stat_output       = cfg->async_stat_output();
+    async_stat_output_queue = cfg->async_stat_output_queue();
+    group_clock_handlers    = cfg->group_clock_handlers();
     std::string timevortex_type(cfg->timeVortex());
     if ( direct_interthread && num_ranks.thread > 1 ) timevortex_type = timevortex_type + ".ts";
     timeVortex = factory->Create<TimeVortex>(timevortex_type, p);
@@ -220,6 +228,17 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
             new SimulatorHeartbeat(cfg, my_rank.rank, this, timeLord.getTimeConverter(cfg->heartbeatPeriod()));
     }
 
+#ifdef USE_MEMPOOL
+    // Each thread trims its own memory pools
+    if ( cfg->mempool_trim_period() != "" ) {
+        if ( my_rank.thread == 0 ) {
+            sim_output.verbose(
+                CALL_INFO, 1, 0, "# Trimming memory pools at period of %s.\n", cfg->mempool_trim_period().c_str());
+        }
+        new MemPoolTrim(this, timeLord.getTimeConverter(cfg->mempool_trim_period()));
+    }
+#endif
+
     // Need to create the thread sync if there is more than one thread
     if ( num_ranks.thread > 1 ) {}
 }
@@ -879,42 +898,45 @@ Simulation_impl::getCompletePhaseElapsedRealTime() const
 }
 
 TimeConverter*
-Simulation_impl::registerClock(const std::string& freq, Clock::HandlerBase* handler, int priority)
+Simulation_impl::registerClock(const std::string& freq, Clock::HandlerBase* handler, int priority, ComponentId_t group)
 {
     TimeConverter* tcFreq = timeLord.getTimeConverter(freq);
-    return registerClock(tcFreq, handler, priority);
+    return registerClock(tcFreq, handler, priority, group);
 }
 
 TimeConverter*
-Simulation_impl::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, int priority)
+Simulation_impl::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, int priority, ComponentId_t group)
 {
     TimeConverter* tcFreq = timeLord.getTimeConverter(freq);
-    return registerClock(tcFreq, handler, priority);
+    return registerClock(tcFreq, handler, priority, group);
 }
 
 TimeConverter*
-Simulation_impl::registerClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority)
+Simulation_impl::registerClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority, ComponentId_t group)
 {
     clockMap_t::key_type mapKey = std::make_pair(tcFreq->getFactor(), priority);
     if ( clockMap.find(mapKey) == clockMap.end() ) {
         Clock* ce        = new Clock(tcFreq, priority);
         clockMap[mapKey] = ce;
 
+        auto* tool = getProfileTool<Profile::ClockHandlerProfileTool>(SST_PROFILE_TOOL_CLOCK);
+        if ( tool != nullptr ) ce->setProfileTool(tool);
+
         ce->schedule();
     }
-    clockMap[mapKey]->registerHandler(handler);
+    clockMap[mapKey]->registerHandler(handler, group_clock_handlers ? group : UNSET_COMPONENT_ID);
     return tcFreq;
 }
 
 Cycle_t
-Simulation_impl::reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority)
+Simulation_impl::reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority, ComponentId_t group)
 {
     clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
     if ( clockMap.find(mapKey) == clockMap.end() ) {
         Output out("Simulation: @R:@t:", 0, 0, Output::STDERR);
         out.fatal(CALL_INFO, 1, "Tried to reregister with a clock that was not previously registered, exiting...\n");
     }
-    clockMap[mapKey]->registerHandler(handler);
+    clockMap[mapKey]->registerHandler(handler, group_clock_handlers ? group : UNSET_COMPONENT_ID);
     return clockMap[mapKey]->getNextCycle();
 }
 
@@ -930,6 +952,30 @@ Simulation_impl::getNextClockCycle(TimeConverter* tc, int priority)
     return clockMap[mapKey]->getNextCycle();
 }
 
+Clock*
+Simulation_impl::getClock(TimeConverter* tc, int priority)
+{
+    clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
+    auto                 iter   = clockMap.find(mapKey);
+    if ( iter == clockMap.end() ) {
+        Output out("Simulation: @R:@t:", 0, 0, Output::STDERR);
+        out.fatal(CALL_INFO, 1, "Tried to access a clock that was not previously registered, exiting...\n");
+    }
+    return iter->second;
+}
+
+bool
+Simulation_impl::suspendClock(TimeConverter* tc, Clock::HandlerBase* handler, Cycle_t wake_cycle, int priority)
+{
+    return getClock(tc, priority)->suspendHandler(handler, wake_cycle);
+}
+
+bool
+Simulation_impl::wakeClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority)
+{
+    return getClock(tc, priority)->wakeHandler(handler);
+}
+
 void
 Simulation_impl::unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority)
 {
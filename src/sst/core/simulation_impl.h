@@ -285,12 +285,17 @@ public:
 
     /******** API provided through BaseComponent only ***********/
 
-    /** Register a handler to be called on a set frequency */
-    TimeConverter* registerClock(const std::string& freq, Clock::HandlerBase* handler, int priority);
+    /** Register a handler to be called on a set frequency.  With
+     * --group-clock-handlers, handlers with the same group are stored
+     * together on the clock. */
+    TimeConverter* registerClock(
+        const std::string& freq, Clock::HandlerBase* handler, int priority, ComponentId_t group = UNSET_COMPONENT_ID);
 
-    TimeConverter* registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, int priority);
+    TimeConverter* registerClock(
+        const UnitAlgebra& freq, Clock::HandlerBase* handler, int priority, ComponentId_t group = UNSET_COMPONENT_ID);
 
-    TimeConverter* registerClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority);
+    TimeConverter* registerClock(
+        TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority, ComponentId_t group = UNSET_COMPONENT_ID);
 
     /** Remove a clock handler from the list of active clock handlers */
     void unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority);
@@ -298,11 +303,21 @@ public:
     /** Reactivate an existing clock and handler.
      * @return time when handler will next fire
      */
-    Cycle_t reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority);
+    Cycle_t reregisterClock(
+        TimeConverter* tc, Clock::HandlerBase* handler, int priority, ComponentId_t group = UNSET_COMPONENT_ID);
 
     /** Returns the next Cycle that the TImeConverter would fire. */
     Cycle_t getNextClockCycle(TimeConverter* tc, int priority = CLOCKPRIORITY);
 
+    /** Return the clock registered for the given frequency and priority */
+    Clock* getClock(TimeConverter* tc, int priority);
+
+    /** Suspend a clock handler until the given cycle of its clock */
+    bool suspendClock(TimeConverter* tc, Clock::HandlerBase* handler, Cycle_t wake_cycle, int priority);
+
+    /** Wake up a suspended clock handler */
+    bool wakeClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority);
+
     /** Return the Statistic Processing Engine associated with this Simulation */
     Statistics::StatisticProcessingEngine* getStatisticsProcessingEngine(void) const;
 
@@ -337,6 +352,13 @@ public:
 
     static std::map<LinkId_t, Link*> cross_thread_links;
     bool                             direct_interthread;
+    std::string                      rank_sync_type;
+    bool                             adaptive_lookahead;
+    std::string                      thread_sync_type;
+    uint64_t                         rank_sync_compression;
+    bool                             async_stat_output;
+    uint64_t                         async_stat_output_queue;
+    bool                             group_clock_handlers;
 
     Component* createComponent(ComponentId_t id, const std::string& name, Params& params);
 
@@ -358,6 +380,7 @@ public:
     } ShutdownMode_t;
 
     friend class SyncManager;
+    friend class ThreadSyncSPSCSkip;
 
     TimeVortex*             timeVortex;
     TimeConverter*          threadMinPartTC;
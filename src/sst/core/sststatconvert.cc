@@ -0,0 +1,278 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statbinaryformat.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace SST::Statistics;
+
+namespace {
+
+struct Field
+{
+    uint8_t     type;
+    size_t      width;
+    std::string name;
+    std::string shortName;
+};
+
+struct Statistic
+{
+    std::string compName;
+    std::string statName;
+    std::string subId;
+    std::string typeName;
+};
+
+void
+print_usage(FILE* output)
+{
+    fprintf(output, "sst-stat-convert [-s <SEPARATOR>] <INPUT> [<OUTPUT>]\n");
+    fprintf(output, "\n");
+    fprintf(output, "Converts a file written by sst.statOutputBinary to the\n");
+    fprintf(output, "CSV format written by sst.statOutputCSV.\n");
+    fprintf(output, "\n");
+    fprintf(output, "<INPUT>      Binary statistic file to convert.\n");
+    fprintf(output, "<OUTPUT>     CSV file to write.  Default is standard output.\n");
+    fprintf(output, "-s <SEP>     Separator between fields.  Default is \", \".\n");
+    fprintf(output, "\n");
+    fprintf(output, "Return: 0 on success, 1 on error\n");
+}
+
+class Reader
+{
+public:
+    Reader(FILE* file, const char* name) : file(file), name(name) {}
+
+    template <typename T>
+    T read()
+    {
+        T val;
+        readBytes(&val, sizeof(T));
+        return val;
+    }
+
+    std::string readString()
+    {
+        uint32_t    len = read<uint32_t>();
+        std::string str(len, '\0');
+        readBytes(&str[0], len);
+        return str;
+    }
+
+    void readBytes(void* buf, size_t size)
+    {
+        if ( size > 0 && fread(buf, size, 1, file) != 1 ) fail("unexpected end of file");
+    }
+
+    /** Returns true if there is no more data in the file */
+    bool atEnd()
+    {
+        int c = fgetc(file);
+        if ( c == EOF ) return true;
+        ungetc(c, file);
+        return false;
+    }
+
+    void fail(const char* msg)
+    {
+        fprintf(stderr, "sst-stat-convert: %s: %s\n", name, msg);
+        exit(1);
+    }
+
+private:
+    FILE*       file;
+    const char* name;
+};
+
+void
+printValue(FILE* out, uint8_t type, const char* loc)
+{
+    switch ( type ) {
+    case BinaryFormat::INT32:
+    {
+        int32_t val;
+        memcpy(&val, loc, sizeof(val));
+        fprintf(out, "%" PRId32, val);
+        break;
+    }
+    case BinaryFormat::UINT32:
+    {
+        uint32_t val;
+        memcpy(&val, loc, sizeof(val));
+        fprintf(out, "%" PRIu32, val);
+        break;
+    }
+    case BinaryFormat::INT64:
+    {
+        int64_t val;
+        memcpy(&val, loc, sizeof(val));
+        fprintf(out, "%" PRId64, val);
+        break;
+    }
+    case BinaryFormat::UINT64:
+    {
+        uint64_t val;
+        memcpy(&val, loc, sizeof(val));
+        fprintf(out, "%" PRIu64, val);
+        break;
+    }
+    case BinaryFormat::FLOAT:
+    {
+        float val;
+        memcpy(&val, loc, sizeof(val));
+        fprintf(out, "%f", val);
+        break;
+    }
+    case BinaryFormat::DOUBLE:
+    {
+        double val;
+        memcpy(&val, loc, sizeof(val));
+        fprintf(out, "%f", val);
+        break;
+    }
+    }
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    std::string              sep = ", ";
+    std::vector<const char*> files;
+
+    for ( int i = 1; i < argc; i++ ) {
+        if ( !strcmp(argv[i], "-h") || !strcmp(argv[i], "--help") ) {
+            print_usage(stdout);
+            return 0;
+        }
+        else if ( !strcmp(argv[i], "-s") ) {
+            if ( ++i == argc ) {
+                print_usage(stderr);
+                return 1;
+            }
+            sep = argv[i];
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+    if ( files.empty() || files.size() > 2 ) {
+        print_usage(stderr);
+        return 1;
+    }
+
+    FILE* in = fopen(files[0], "rb");
+    if ( nullptr == in ) {
+        fprintf(stderr, "sst-stat-convert: unable to open %s: %s\n", files[0], strerror(errno));
+        return 1;
+    }
+    FILE* out = stdout;
+    if ( files.size() == 2 ) {
+        out = fopen(files[1], "w");
+        if ( nullptr == out ) {
+            fprintf(stderr, "sst-stat-convert: unable to open %s: %s\n", files[1], strerror(errno));
+            return 1;
+        }
+    }
+
+    Reader reader(in, files[0]);
+
+    char magic[sizeof(BinaryFormat::magic)];
+    reader.readBytes(magic, sizeof(magic));
+    if ( memcmp(magic, BinaryFormat::magic, sizeof(magic)) ) reader.fail("not an SST binary statistic file");
+    if ( reader.read<uint32_t>() != BinaryFormat::version ) reader.fail("unsupported file version");
+    if ( reader.read<uint32_t>() != BinaryFormat::endian_check )
+        reader.fail("file was written on a machine with a different byte order");
+    int32_t rank = reader.read<int32_t>();
+
+    std::vector<Field> fields(reader.read<uint32_t>());
+    for ( auto& field : fields ) {
+        field.type      = reader.read<uint8_t>();
+        field.width     = BinaryFormat::fieldWidth(field.type);
+        field.name      = reader.readString();
+        field.shortName = reader.readString();
+        if ( 0 == field.width ) reader.fail("unknown field type");
+    }
+
+    // Same header as sst.statOutputCSV
+    fprintf(out, "ComponentName%sStatisticName%sStatisticSubId%sStatisticType%s", sep.c_str(), sep.c_str(),
+        sep.c_str(), sep.c_str());
+    fprintf(out, "SimTime%sRank%s", sep.c_str(), sep.c_str());
+    for ( size_t i = 0; i < fields.size(); i++ ) {
+        fprintf(out, "%s.%s%s", fields[i].name.c_str(), fields[i].shortName.c_str(),
+            i + 1 < fields.size() ? sep.c_str() : "");
+    }
+    fprintf(out, "\n");
+
+    std::vector<Statistic>            stats;
+    std::vector<uint64_t>             times;
+    std::vector<uint32_t>             indices;
+    std::vector<std::vector<uint8_t>> valid(fields.size());
+    std::vector<std::vector<char>>    columns(fields.size());
+
+    while ( !reader.atEnd() ) {
+        if ( reader.read<uint32_t>() != BinaryFormat::block_tag ) reader.fail("corrupt block header");
+
+        uint32_t newStats = reader.read<uint32_t>();
+        for ( uint32_t i = 0; i < newStats; i++ ) {
+            Statistic stat;
+            stat.compName = reader.readString();
+            stat.statName = reader.readString();
+            stat.subId    = reader.readString();
+            stat.typeName = reader.readString();
+            stats.push_back(stat);
+        }
+
+        uint64_t rows = reader.read<uint64_t>();
+        times.resize(rows);
+        indices.resize(rows);
+        reader.readBytes(times.data(), rows * sizeof(uint64_t));
+        reader.readBytes(indices.data(), rows * sizeof(uint32_t));
+        for ( size_t f = 0; f < fields.size(); f++ ) {
+            valid[f].resize((rows + 7) / 8);
+            columns[f].resize(rows * fields[f].width);
+            reader.readBytes(valid[f].data(), valid[f].size());
+            reader.readBytes(columns[f].data(), columns[f].size());
+        }
+
+        for ( uint64_t row = 0; row < rows; row++ ) {
+            if ( indices[row] >= stats.size() ) reader.fail("statistic index out of range");
+            const Statistic& stat = stats[indices[row]];
+            fprintf(out, "%s%s%s%s%s%s%s%s", stat.compName.c_str(), sep.c_str(), stat.statName.c_str(), sep.c_str(),
+                stat.subId.c_str(), sep.c_str(), stat.typeName.c_str(), sep.c_str());
+            fprintf(out, "%" PRIu64 "%s%d%s", times[row], sep.c_str(), rank, sep.c_str());
+            for ( size_t f = 0; f < fields.size(); f++ ) {
+                // Fields the statistic didn't output are written as 0,
+                // just like sst.statOutputCSV
+                if ( valid[f][row / 8] & (1 << (row % 8)) )
+                    printValue(out, fields[f].type, columns[f].data() + row * fields[f].width);
+                else
+                    fprintf(out, "0");
+                if ( f + 1 < fields.size() ) fprintf(out, "%s", sep.c_str());
+            }
+            fprintf(out, "\n");
+        }
+    }
+
+    fclose(in);
+    if ( out != stdout ) fclose(out);
+    return 0;
+}
@@ -155,6 +155,32 @@ public:
         this->setCollectionCount(0);
     }
 
+    StatisticBase* createMergeTarget() override
+    {
+        Params params = this->getParams();
+        return new AccumulatorStatistic<NumberBase>(
+            this->getComponent(), this->getStatName(), this->getStatSubId(), params);
+    }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        AccumulatorStatistic<NumberBase>* stat = static_cast<AccumulatorStatistic<NumberBase>*>(other);
+        if ( 0 == stat->getCount() ) return;
+        m_sum += stat->m_sum;
+        m_sum_sq += stat->m_sum_sq;
+        m_min = (stat->m_min < m_min) ? stat->m_min : m_min;
+        m_max = (stat->m_max > m_max) ? stat->m_max : m_max;
+        this->setCollectionCount(getCount() + stat->getCount());
+    }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_sum;
+        ser& m_sum_sq;
+        ser& m_min;
+        ser& m_max;
+    }
+
     void registerOutputFields(StatisticFieldsOutput* statOutput) override
     {
         h_sum   = statOutput->registerField<NumberBase>("Sum");
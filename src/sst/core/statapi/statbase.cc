@@ -16,11 +16,14 @@
 #include "sst/core/baseComponent.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/stataccumulator.h"
+#include "sst/core/statapi/statfixedhistogram.h"
 #include "sst/core/statapi/stathistogram.h"
+#include "sst/core/statapi/stathyperloglog.h"
 #include "sst/core/statapi/statnull.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/statapi/statoutputjson.h"
 #include "sst/core/statapi/statoutputtxt.h"
+#include "sst/core/statapi/statquantilesketch.h"
 #include "sst/core/statapi/statuniquecount.h"
 
 namespace SST {
@@ -49,9 +52,17 @@ StatisticBase::ELI_getParams()
 const std::string&
 StatisticBase::getCompName() const
 {
+    if ( !m_mergedCompName.empty() ) return m_mergedCompName;
     return m_component->getName();
 }
 
+void
+StatisticBase::setMergedCompName(const std::string& name)
+{
+    m_mergedCompName = name;
+    m_statFullName   = buildStatisticFullName(name, m_statName, m_statSubId);
+}
+
 void
 Statistic<void>::outputStatisticFields(StatisticFieldsOutput* UNUSED(statOutput), bool UNUSED(EndOfSimFlag))
 {
@@ -217,6 +228,13 @@ SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(FixedHistogramStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(FixedHistogramStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(FixedHistogramStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(FixedHistogramStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(FixedHistogramStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(FixedHistogramStatistic, double);
+
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int64_t);
@@ -224,5 +242,19 @@ SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, double);
+
+SST_ELI_INSTANTIATE_STATISTIC(HyperLogLogStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(HyperLogLogStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(HyperLogLogStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(HyperLogLogStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(HyperLogLogStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(HyperLogLogStatistic, double);
+
 } // namespace Statistics
 } // namespace SST
@@ -29,6 +29,7 @@ class Factory;
 namespace Statistics {
 class StatisticOutput;
 class StatisticFieldsOutput;
+class StatisticOutputAsyncWriter;
 class StatisticProcessingEngine;
 class StatisticGroup;
 
@@ -184,11 +185,39 @@ public:
     /** Indicate if the Statistic is a NullStatistic */
     virtual bool isNullStatistic() const { return false; }
 
+    // Merging of Statistics
+    /** Create an empty statistic of the same type, name and parameters
+     * that other instances of this statistic can be merged into.
+     * @return The new statistic, or nullptr if the statistic can't be merged
+     */
+    virtual StatisticBase* createMergeTarget() { return nullptr; }
+
+    /** Add the data collected by another statistic into this one.  The
+     * other statistic was created from the same merge target type.
+     * @param other - Statistic to merge, it is not modified
+     */
+    virtual void mergeStatisticData(StatisticBase* UNUSED(other)) {}
+
+    /** Return the parameters that have to be the same for statistics
+     * of this type to be merged, such as the bin layout.  Statistics
+     * whose parameters don't match can't be put in the same merge
+     * target.
+     */
+    virtual std::string getMergeParams() const { return ""; }
+
+    /** Pack or unpack the data collected by the statistic, not including
+     * the collection count, so statistics on other ranks can be merged
+     * into it.  Statistics that can be merged must implement this.
+     * @param ser - Serializer to pack or unpack with
+     */
+    virtual void serializeStatisticData(SST::Core::Serialization::serializer& UNUSED(ser)) {}
+
 protected:
     friend class SST::Statistics::StatisticProcessingEngine;
     friend class SST::Statistics::StatisticOutput;
     friend class SST::Statistics::StatisticGroup;
     friend class SST::Statistics::StatisticFieldsOutput;
+    friend class SST::Statistics::StatisticOutputAsyncWriter;
 
     /** Construct a StatisticBase
      * @param comp - Pointer to the parent constructor.
@@ -261,6 +290,9 @@ private:
     const StatisticGroup* getGroup() const { return m_group; }
     void                  setGroup(const StatisticGroup* group) { m_group = group; }
 
+    /** Name the statistic after a merged group rather than its component */
+    void setMergedCompName(const std::string& name);
+
 protected:
     StatisticBase(); // For serialization only
 
@@ -290,6 +322,7 @@ private:
     OneShot::HandlerBase* m_outputDelayedHandler;
     OneShot::HandlerBase* m_collectionDelayedHandler;
     const StatisticGroup* m_group;
+    std::string           m_mergedCompName;
 };
 
 /**
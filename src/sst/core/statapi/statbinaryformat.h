@@ -0,0 +1,86 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATBINARYFORMAT_H
+#define SST_CORE_STATAPI_STATBINARYFORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SST {
+namespace Statistics {
+
+/**
+   Layout of the files written by StatisticOutputBinary.  This header
+   is shared with the sst-stat-convert tool and must not depend on the
+   rest of the core.
+
+   All values are in the byte order of the machine that wrote the
+   file; endian_check lets a reader detect a mismatch.  Strings are a
+   uint32_t length followed by that many characters, with no
+   terminator.
+
+   File header:
+     char[8]  magic
+     uint32_t version
+     uint32_t endian_check
+     int32_t  rank
+     uint32_t number of fields
+     per field: uint8_t FieldType, string field name, string type short name
+
+   Followed by any number of blocks, normally one per output time:
+     uint32_t block_tag
+     uint32_t number of statistics first seen in this block
+     per new statistic: string component name, string statistic name,
+                        string statistic subid, string statistic type
+     uint64_t number of rows
+     uint64_t[rows] simulation time
+     uint32_t[rows] statistic index, in the order statistics were first seen
+     per field: uint8_t[(rows + 7) / 8] bitmap of the rows the field was
+                output in, least significant bit first, then rows values
+                of fieldWidth(type) bytes each
+
+   Fields a statistic does not output are stored as zero with their
+   bit clear.
+*/
+namespace BinaryFormat {
+
+static const char     magic[8]     = { 'S', 'S', 'T', 'S', 'T', 'A', 'T', 'B' };
+static const uint32_t version      = 1;
+static const uint32_t endian_check = 0x01020304;
+static const uint32_t block_tag    = 0x4b434c42; // "BLCK"
+
+enum FieldType : uint8_t { INT32 = 0, UINT32, INT64, UINT64, FLOAT, DOUBLE };
+
+/** Returns the number of bytes a value of the field type takes, or 0
+ * for an unknown type */
+inline size_t
+fieldWidth(uint8_t type)
+{
+    switch ( type ) {
+    case INT32:
+    case UINT32:
+    case FLOAT:
+        return 4;
+    case INT64:
+    case UINT64:
+    case DOUBLE:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+} // namespace BinaryFormat
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATBINARYFORMAT_H
@@ -17,6 +17,7 @@
 #include "sst/core/configGraph.h"
 #include "sst/core/eli/elementinfo.h"
 #include "sst/core/factory.h"
+#include "sst/core/objectComms.h"
 #include "sst/core/output.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/statbase.h"
@@ -25,7 +26,17 @@
 #include "sst/core/timeLord.h"
 #include "sst/core/warnmacros.h"
 
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
 #include <algorithm>
+#include <set>
 #include <string>
 
 namespace SST {
@@ -55,6 +66,8 @@ StatisticProcessingEngine::setup(ConfigGraph* graph)
 
         /* Force component / statistic registration for Group stats*/
         for ( ComponentId_t compID : cfg.second.components ) {
+            // Components on other ranks aren't in this rank's graph
+            if ( !graph->containsComponent(COMPONENT_ID_MASK(compID)) ) continue;
             ConfigComponent* ccomp = graph->findComponent(compID);
             if ( ccomp ) { /* Should always be true */
                 for ( auto& kv : cfg.second.statMap ) {
@@ -132,7 +145,15 @@ StatisticProcessingEngine::registerStatisticCore(StatisticBase* stat)
 
     // Make sure that the wireup has not been completed
     if ( true == Simulation_impl::getSimulation()->isWireUpFinished() ) {
-        if ( !group.output->supportsDynamicRegistration() ) {
+        if ( group.merge ) {
+            // Other threads may be merging the group's statistics
+            m_output.fatal(
+                CALL_INFO, 1,
+                "ERROR: Statistic %s - "
+                "Cannot be added to merged statistic group %s after the Components have been wired up\n",
+                stat->getFullStatName().c_str(), group.name.c_str());
+        }
+        else if ( !group.output->supportsDynamicRegistration() ) {
             m_output.fatal(
                 CALL_INFO, 1,
                 "ERROR: Statistic %s - "
@@ -151,7 +172,10 @@ StatisticProcessingEngine::registerStatisticCore(StatisticBase* stat)
     }
 
     /* All checks pass.  Add the stat */
-    group.addStatistic(stat);
+    if ( group.merge )
+        group.addMergedStatistic(stat, Simulation_impl::getSimulation()->getRank().thread);
+    else
+        group.addStatistic(stat);
 
     if ( group.isDefault ) { getOutputForStatistic(stat)->registerStatistic(stat); }
 
@@ -167,10 +191,28 @@ StatisticProcessingEngine::finalizeInitialization()
     bool master = (Simulation_impl::getSimulation()->getRank().thread == 0);
     if ( master ) { m_barrier.resize(Simulation_impl::getSimulation()->getNumRanks().thread); }
     for ( auto& g : m_statGroups ) {
-        if ( master ) { g.output->registerGroup(&g); }
+        if ( master ) {
+            if ( g.output->acceptsGroups() ) { g.output->registerGroup(&g); }
+            else {
+                // Merged groups can be written as ordinary statistics
+                for ( auto& stat : g.stats ) {
+                    g.output->registerStatistic(stat);
+                }
+            }
+        }
 
         /* Register group clock, if rate is set */
         if ( g.outputFreq.getValue() != 0 ) {
+            // Ranks are only merged at the end of simulation, so
+            // periodic output would write one partial result per rank
+            if ( g.merge && Simulation_impl::getSimulation()->getNumRanks().rank > 1 ) {
+                m_output.fatal(
+                    CALL_INFO, 1,
+                    "ERROR: Statistic Group %s merges its statistics and can't have an output frequency when "
+                    "running on more than one rank.  Merged groups are only written at the end of simulation in "
+                    "parallel runs.\n",
+                    g.name.c_str());
+            }
             Simulation_impl::getSimulation()->registerClock(
                 g.outputFreq,
                 new Clock::Handler<StatisticProcessingEngine, StatisticGroup*>(
@@ -185,8 +227,14 @@ StatisticProcessingEngine::startOfSimulation()
 {
     m_SimulationStarted = true;
 
+    Simulation_impl* sim = Simulation_impl::getSimulation();
     for ( auto& so : m_statOutputs ) {
         so->startOfSimulation();
+
+        if ( sim->async_stat_output ) {
+            StatisticFieldsOutput* fso = dynamic_cast<StatisticFieldsOutput*>(so);
+            if ( fso ) fso->startAsyncOutput(sim->async_stat_output_queue);
+        }
     }
 }
 
@@ -221,11 +269,32 @@ StatisticProcessingEngine::endOfSimulation()
         }
     }
 
+    // Merged groups are combined across ranks before they are written
+    std::vector<StatisticGroup*> mergedGroups;
     for ( auto& sg : m_statGroups ) {
-        performStatisticGroupOutputImpl(sg, true);
+        if ( sg.merge ) {
+            for ( uint32_t t = 0; t < Simulation_impl::getSimulation()->getNumRanks().thread; t++ ) {
+                sg.mergeThreadStatistics(t, false);
+            }
+            sg.mergeThreadResults();
+            mergedGroups.push_back(&sg);
+        }
+        else {
+            performStatisticGroupOutputImpl(sg, true);
+        }
+    }
+    mergeRankStatisticGroups(mergedGroups);
+    if ( true == m_SimulationStarted ) {
+        for ( StatisticGroup* sg : mergedGroups ) {
+            outputMergedStatisticGroup(*sg, true);
+        }
     }
 
     for ( auto& so : m_statOutputs ) {
+        // Anything still buffered has to be written before the
+        // output is closed
+        StatisticFieldsOutput* fso = dynamic_cast<StatisticFieldsOutput*>(so);
+        if ( fso ) fso->stopAsyncOutput();
         so->endOfSimulation();
     }
 }
@@ -428,10 +497,24 @@ StatisticProcessingEngine::setStatisticStopTime(StatisticBase* stat)
 void
 StatisticProcessingEngine::performStatisticOutput(StatisticBase* stat, bool endOfSimFlag /*=false*/)
 {
-    if ( stat->getGroup()->isDefault )
+    StatisticGroup* group = const_cast<StatisticGroup*>(stat->getGroup());
+    if ( group->isDefault ) {
         performStatisticOutputImpl(stat, endOfSimFlag);
-    else
-        performStatisticGroupOutputImpl(*const_cast<StatisticGroup*>(stat->getGroup()), endOfSimFlag);
+        return;
+    }
+
+    // Merged groups are only combined by the group clock, when every
+    // thread is at the barrier, or at the end of simulation.  Merging
+    // here would read the other threads' statistics while they are
+    // still collecting.
+    if ( group->merge && !endOfSimFlag ) {
+        m_output.fatal(
+            CALL_INFO, 1,
+            "ERROR: Statistic %s - Output of merged statistic group %s can't be triggered by a component\n",
+            stat->getFullStatName().c_str(), group->name.c_str());
+    }
+
+    performStatisticGroupOutputImpl(*group, endOfSimFlag);
 }
 
 void
@@ -458,7 +541,8 @@ StatisticProcessingEngine::performStatisticOutputImpl(StatisticBase* stat, bool
 }
 
 void
-StatisticProcessingEngine::performStatisticGroupOutputImpl(StatisticGroup& group, bool endOfSimFlag /*=false*/)
+StatisticProcessingEngine::performStatisticGroupOutputImpl(
+    StatisticGroup& group, bool endOfSimFlag /*=false*/, bool threadsMerged /*=false*/)
 {
 
     StatisticOutput* statOutput = group.output;
@@ -466,6 +550,21 @@ StatisticProcessingEngine::performStatisticGroupOutputImpl(StatisticGroup& group
     // Has the simulation started?
     if ( true == m_SimulationStarted ) {
 
+        if ( group.merge ) {
+            // The group clock merges each thread's statistics on that
+            // thread before calling here
+            if ( !threadsMerged ) {
+                for ( uint32_t t = 0; t < Simulation_impl::getSimulation()->getNumRanks().thread; t++ ) {
+                    group.mergeThreadStatistics(t, !endOfSimFlag);
+                }
+            }
+            group.mergeThreadResults();
+
+            // The component statistics were reset while merging
+            outputMergedStatisticGroup(group, endOfSimFlag);
+            return;
+        }
+
         statOutput->outputGroup(&group, endOfSimFlag);
 
         if ( false == endOfSimFlag ) {
@@ -480,6 +579,97 @@ StatisticProcessingEngine::performStatisticGroupOutputImpl(StatisticGroup& group
     }
 }
 
+void
+StatisticProcessingEngine::outputMergedStatisticGroup(StatisticGroup& group, bool endOfSimFlag)
+{
+    StatisticOutput* statOutput = group.output;
+    if ( statOutput->acceptsGroups() ) { statOutput->outputGroup(&group, endOfSimFlag); }
+    else {
+        for ( auto& stat : group.stats ) {
+            statOutput->output(stat, endOfSimFlag);
+        }
+    }
+}
+
+void
+StatisticProcessingEngine::mergeRankStatisticGroups(std::vector<StatisticGroup*>& UNUSED_WO_MPI(groups))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    int numRanks = Simulation_impl::getSimulation()->getNumRanks().rank;
+    int myRank   = Simulation_impl::getSimulation()->getRank().rank;
+    if ( 1 == numRanks ) return;
+
+    // A rank only has the groups of its own components, and may have a
+    // group without any statistics in it, so first find which rank
+    // writes each group.  The writer has to hold statistics to merge
+    // into, so it is the lowest rank that does, or the lowest rank with
+    // the group if none of them do.
+    std::map<std::string, bool> names;
+    for ( StatisticGroup* group : groups ) {
+        names[group->name] = !group->stats.empty();
+    }
+    std::vector<std::map<std::string, bool>> allNames;
+    Comms::all_gather(names, allNames);
+
+    std::map<std::string, int> writer;
+    for ( int rank = numRanks - 1; rank >= 0; rank-- ) {
+        for ( auto& name : allNames[rank] ) {
+            auto current = writer.find(name.first);
+            if ( current == writer.end() || name.second || !allNames[current->second].at(name.first) )
+                writer[name.first] = rank;
+        }
+    }
+
+    // Ranks with no statistics in a group have nothing to send
+    std::set<int> sources;
+    for ( int rank = 0; rank < numRanks; rank++ ) {
+        if ( rank == myRank ) continue;
+        for ( auto& name : allNames[rank] ) {
+            if ( name.second && writer[name.first] == myRank ) sources.insert(rank);
+        }
+    }
+
+    // Send each writer one message with all of its groups
+    std::map<int, std::map<std::string, std::vector<char>>> outgoing;
+    for ( StatisticGroup* group : groups ) {
+        int dest = writer[group->name];
+        if ( dest != myRank && !group->stats.empty() ) outgoing[dest][group->name] = group->packMergedStatistics();
+    }
+
+    const int                      tag = 0x5347; // Merged statistic groups
+    std::vector<std::vector<char>> sendBuffers;
+    std::vector<MPI_Request>       requests(outgoing.size());
+    for ( auto& msg : outgoing ) {
+        sendBuffers.push_back(Comms::serialize(msg.second));
+        MPI_Isend(
+            sendBuffers.back().data(), sendBuffers.back().size(), MPI_BYTE, msg.first, tag, MPI_COMM_WORLD,
+            &requests[sendBuffers.size() - 1]);
+    }
+
+    for ( int src : sources ) {
+        MPI_Status status;
+        int        size = 0;
+        MPI_Probe(src, tag, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, MPI_BYTE, &size);
+        std::vector<char> buffer(size);
+        MPI_Recv(buffer.data(), size, MPI_BYTE, src, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        std::map<std::string, std::vector<char>> incoming;
+        Comms::deserialize(buffer, incoming);
+        for ( StatisticGroup* group : groups ) {
+            auto packed = incoming.find(group->name);
+            if ( packed != incoming.end() ) group->mergePackedStatistics(packed->second, src);
+        }
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    groups.erase(
+        std::remove_if(
+            groups.begin(), groups.end(), [&](StatisticGroup* group) { return writer[group->name] != myRank; }),
+        groups.end());
+#endif
+}
+
 void
 StatisticProcessingEngine::performGlobalStatisticOutput(bool endOfSimFlag /*=false*/)
 {
@@ -531,8 +721,15 @@ StatisticProcessingEngine::handleStatisticEngineClockEvent(Cycle_t UNUSED(CycleN
 bool
 StatisticProcessingEngine::handleGroupClockEvent(Cycle_t UNUSED(CycleNum), StatisticGroup* group)
 {
+    uint32_t thread = Simulation_impl::getSimulation()->getRank().thread;
     m_barrier.wait();
-    if ( Simulation_impl::getSimulation()->getRank().thread == 0 ) { performStatisticGroupOutputImpl(*group, false); }
+    if ( group->merge ) {
+        // Each thread merges its own statistics, so thread 0 only has
+        // to combine one partial result per thread
+        group->mergeThreadStatistics(thread, true);
+        m_barrier.wait();
+    }
+    if ( thread == 0 ) { performStatisticGroupOutputImpl(*group, false, true); }
     m_barrier.wait();
     return false;
 }
@@ -112,7 +112,15 @@ private:
     void endOfSimulation();
 
     void performStatisticOutputImpl(StatisticBase* stat, bool endOfSimFlag);
-    void performStatisticGroupOutputImpl(StatisticGroup& group, bool endOfSimFlag);
+    void performStatisticGroupOutputImpl(StatisticGroup& group, bool endOfSimFlag, bool threadsMerged = false);
+    void outputMergedStatisticGroup(StatisticGroup& group, bool endOfSimFlag);
+
+    /** Combine merged groups across ranks.  Each group is combined on
+     * the lowest rank that has it.  Every rank must call this.
+     * @param groups - Merged groups on this rank, reduced to the ones
+     * this rank writes
+     */
+    void mergeRankStatisticGroups(std::vector<StatisticGroup*>& groups);
 
     bool           handleStatisticEngineClockEvent(Cycle_t CycleNum, SimTime_t timeFactor);
     bool           handleGroupClockEvent(Cycle_t CycleNum, StatisticGroup* group);
@@ -0,0 +1,351 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATFIXEDHISTOGRAM_H
+#define SST_CORE_STATAPI_STATFIXEDHISTOGRAM_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/stathistogram.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <cmath>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class FixedHistogramStatistic
+    Holder of data grouped into a fixed number of bins.  Takes the same
+    parameters and writes the same fields as HistogramStatistic, but the
+    bins are kept in an array and the bin for a value is computed
+    arithmetically, so adding data never searches or allocates.
+
+    With log2bins set, bin 0 holds values equal to minvalue and bin N
+    holds values whose offset from minvalue is in [2^(N-1), 2^N).
+    binwidth is ignored in that mode.
+    \tparam BinDataType is the type of the data held in each bin (i.e. what data type described the width of the bin)
+*/
+template <class BinDataType>
+class FixedHistogramStatistic : public Statistic<BinDataType>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        FixedHistogramStatistic,
+        "sst",
+        "FixedHistogramStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Track distribution of statistic across a fixed array of linear or log2 bins",
+        "SST::Statistic<T>")
+
+    FixedHistogramStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<BinDataType>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("minvalue");
+        allowedKeySet.insert("binwidth");
+        allowedKeySet.insert("numbins");
+        allowedKeySet.insert("log2bins");
+        allowedKeySet.insert("dumpbinsonoutput");
+        allowedKeySet.insert("includeoutofbounds");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // Process the Parameters
+        m_minValue           = statParams.find<BinDataType>("minvalue", 0);
+        m_binWidth           = statParams.find<NumBinsType>("binwidth", 5000);
+        m_numBins            = statParams.find<NumBinsType>("numbins", 100);
+        m_log2Bins           = statParams.find<bool>("log2bins", false);
+        m_dumpBinsOnOutput   = statParams.find<bool>("dumpbinsonoutput", true);
+        m_includeOutOfBounds = statParams.find<bool>("includeoutofbounds", true);
+
+        if ( m_log2Bins ) {
+            // Bin 64 already holds the largest 64-bit offset
+            if ( m_numBins > 65 ) m_numBins = 65;
+            m_binWidth = 0;
+        }
+        else if ( 0 == m_binWidth ) {
+            m_binWidth = 1;
+        }
+
+        // Power of two widths are binned with a shift instead of a divide
+        m_binShift = -1;
+        if ( !m_log2Bins && 0 == (m_binWidth & (m_binWidth - 1)) ) {
+            m_binShift = 0;
+            while ( (NumBinsType(1) << m_binShift) != m_binWidth )
+                m_binShift++;
+        }
+
+        m_bins.resize(m_numBins, 0);
+
+        // Initialize other properties
+        m_totalSummed      = 0;
+        m_totalSummedSqr   = 0;
+        m_OOBMinCount      = 0;
+        m_OOBMaxCount      = 0;
+        m_itemsBinnedCount = 0;
+        this->setCollectionCount(0);
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("FixedHistogram");
+    }
+
+    ~FixedHistogramStatistic() {}
+
+protected:
+    /**
+        Adds a new value to the histogram.  The bin is computed from the
+        offset of the value from the minimum and incremented.
+    */
+    void addData_impl_Ntimes(uint64_t N, BinDataType value) override
+    {
+        if ( value < m_minValue ) {
+            m_OOBMinCount += N;
+            return;
+        }
+
+        uint64_t bin = getBinIndex(value, std::is_integral<BinDataType>());
+        if ( bin >= m_numBins ) {
+            m_OOBMaxCount += N;
+            return;
+        }
+
+        // This value is to be binned...
+        // Add the "in limits" value to the total summation's
+        m_totalSummed += N * value;
+        m_totalSummedSqr += N * (value * value);
+        m_itemsBinnedCount += N;
+        m_bins[bin] += N;
+    }
+
+    void addData_impl(BinDataType value) override { addData_impl_Ntimes(1, value); }
+
+private:
+    /** Bin index for an integer value at or above the minimum.  The
+     * result is >= m_numBins for values above the last bin. */
+    uint64_t getBinIndex(BinDataType value, std::true_type)
+    {
+        // Unsigned arithmetic so the offset can't overflow for signed types
+        uint64_t offset = (uint64_t)value - (uint64_t)m_minValue;
+        if ( m_log2Bins ) return 0 == offset ? 0 : 64 - __builtin_clzll(offset);
+        if ( m_binShift >= 0 ) return offset >> m_binShift;
+        return offset / m_binWidth;
+    }
+
+    /** Bin index for a floating point value at or above the minimum */
+    uint64_t getBinIndex(BinDataType value, std::false_type)
+    {
+        double offset = (double)value - (double)m_minValue;
+        if ( m_log2Bins ) return offset < 1.0 ? 0 : std::ilogb(offset) + 1;
+        // Check the range first so the conversion can't overflow
+        double bin = std::floor(offset / m_binWidth);
+        return bin < m_numBins ? (uint64_t)bin : m_numBins;
+    }
+
+    /** Get the smallest value that falls in a bin */
+    BinDataType getBinLowerValue(NumBinsType bin)
+    {
+        if ( !m_log2Bins ) return (bin * (uint64_t)m_binWidth) + m_minValue; // Force full 64-bit multiply
+        if ( 0 == bin ) return m_minValue;
+        return m_minValue + (BinDataType)(1ULL << (bin - 1));
+    }
+
+    /** Get the largest value that falls in a bin */
+    BinDataType getBinUpperValue(NumBinsType bin)
+    {
+        if ( !m_log2Bins ) return getBinLowerValue(bin) + m_binWidth - 1;
+        if ( 0 == bin ) return m_minValue;
+        // Wraps to the largest 64-bit value for bin 64
+        return m_minValue + (BinDataType)((1ULL << (bin - 1)) * 2 - 1);
+    }
+
+    /** Get the largest possible value represented by this histogram */
+    BinDataType getBinsMaxValue() { return 0 == m_numBins ? m_minValue : getBinUpperValue(m_numBins - 1); }
+
+    /** Count how many bins have items in them */
+    NumBinsType getActiveBinCount()
+    {
+        NumBinsType count = 0;
+        for ( CountType bin : m_bins ) {
+            if ( bin ) count++;
+        }
+        return count;
+    }
+
+    void clearStatisticData() override
+    {
+        m_totalSummed      = 0;
+        m_totalSummedSqr   = 0;
+        m_OOBMinCount      = 0;
+        m_OOBMaxCount      = 0;
+        m_itemsBinnedCount = 0;
+        std::fill(m_bins.begin(), m_bins.end(), 0);
+        this->setCollectionCount(0);
+    }
+
+    StatisticBase* createMergeTarget() override
+    {
+        Params params = this->getParams();
+        return new FixedHistogramStatistic<BinDataType>(
+            this->getComponent(), this->getStatName(), this->getStatSubId(), params);
+    }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        // Statistics are only merged if getMergeParams() matches, so
+        // the bins line up
+        FixedHistogramStatistic<BinDataType>* stat = static_cast<FixedHistogramStatistic<BinDataType>*>(other);
+        m_totalSummed += stat->m_totalSummed;
+        m_totalSummedSqr += stat->m_totalSummedSqr;
+        m_OOBMinCount += stat->m_OOBMinCount;
+        m_OOBMaxCount += stat->m_OOBMaxCount;
+        m_itemsBinnedCount += stat->m_itemsBinnedCount;
+        for ( size_t i = 0; i < m_bins.size(); i++ ) {
+            m_bins[i] += stat->m_bins[i];
+        }
+        this->setCollectionCount(this->getCollectionCount() + stat->getCollectionCount());
+    }
+
+    std::string getMergeParams() const override
+    {
+        std::stringstream params;
+        params.precision(17);
+        params << "minvalue=" << +m_minValue << " binwidth=" << +m_binWidth << " numbins=" << +m_numBins
+               << " log2bins=" << m_log2Bins;
+        return params.str();
+    }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_totalSummed;
+        ser& m_totalSummedSqr;
+        ser& m_OOBMinCount;
+        ser& m_OOBMaxCount;
+        ser& m_itemsBinnedCount;
+        ser& m_bins;
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        // Same fields as HistogramStatistic so the outputs can be compared
+        m_Fields.push_back(statOutput->registerField<BinDataType>("BinsMinValue"));
+        m_Fields.push_back(statOutput->registerField<BinDataType>("BinsMaxValue"));
+        m_Fields.push_back(statOutput->registerField<NumBinsType>("BinWidth"));
+        m_Fields.push_back(statOutput->registerField<NumBinsType>("TotalNumBins"));
+        m_Fields.push_back(statOutput->registerField<BinDataType>("Sum"));
+        m_Fields.push_back(statOutput->registerField<BinDataType>("SumSQ"));
+        m_Fields.push_back(statOutput->registerField<NumBinsType>("NumActiveBins"));
+        m_Fields.push_back(statOutput->registerField<CountType>("NumItemsCollected"));
+        m_Fields.push_back(statOutput->registerField<CountType>("NumItemsBinned"));
+
+        if ( true == m_includeOutOfBounds ) {
+            m_Fields.push_back(statOutput->registerField<CountType>("NumOutOfBounds-MinValue"));
+            m_Fields.push_back(statOutput->registerField<CountType>("NumOutOfBounds-MaxValue"));
+        }
+
+        // Do we also need to dump the bin counts on output
+        if ( true == m_dumpBinsOnOutput ) {
+            for ( NumBinsType y = 0; y < m_numBins; y++ ) {
+                // Build the string name for this bin and add it as a field
+                std::stringstream ss;
+                ss << "Bin" << y << ":" << getBinLowerValue(y) << "-" << getBinUpperValue(y);
+                m_Fields.push_back(statOutput->registerField<CountType>(ss.str().c_str()));
+            }
+        }
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        uint32_t x = 0;
+        statOutput->outputField(m_Fields[x++], m_minValue);
+        statOutput->outputField(m_Fields[x++], getBinsMaxValue());
+        statOutput->outputField(m_Fields[x++], m_binWidth);
+        statOutput->outputField(m_Fields[x++], m_numBins);
+        statOutput->outputField(m_Fields[x++], m_totalSummed);
+        statOutput->outputField(m_Fields[x++], m_totalSummedSqr);
+        statOutput->outputField(m_Fields[x++], getActiveBinCount());
+        statOutput->outputField(m_Fields[x++], this->getCollectionCount());
+        statOutput->outputField(m_Fields[x++], m_itemsBinnedCount);
+
+        if ( true == m_includeOutOfBounds ) {
+            statOutput->outputField(m_Fields[x++], m_OOBMinCount);
+            statOutput->outputField(m_Fields[x++], m_OOBMaxCount);
+        }
+
+        // Do we also need to dump the bin counts on output
+        if ( true == m_dumpBinsOnOutput ) {
+            for ( CountType bin : m_bins ) {
+                statOutput->outputField(m_Fields[x++], bin);
+            }
+        }
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        switch ( mode ) {
+        case StatisticBase::STAT_MODE_COUNT:
+        case StatisticBase::STAT_MODE_PERIODIC:
+        case StatisticBase::STAT_MODE_DUMP_AT_END:
+            return true;
+        default:
+            return false;
+        }
+        return false;
+    }
+
+private:
+    // The minimum value in the Histogram
+    BinDataType m_minValue;
+
+    // The width of each Histogram bin, 0 for log2 bins
+    NumBinsType m_binWidth;
+
+    // log2 of the bin width when it is a power of two, otherwise -1
+    int m_binShift;
+
+    // The number of bins to be supported
+    NumBinsType m_numBins;
+
+    // Bin N holds offsets from the minimum in [2^(N-1), 2^N)
+    bool m_log2Bins;
+
+    // Out of bounds bins
+    CountType m_OOBMinCount;
+    CountType m_OOBMaxCount;
+
+    // Count of Items that have binned, (Different than item count as some
+    // items may be out of bounds and not binned)
+    CountType m_itemsBinnedCount;
+
+    // The sum of all values added into the Histogram
+    BinDataType m_totalSummed;
+
+    // The sum of values added to the Histogram squared
+    BinDataType m_totalSummedSqr;
+
+    // The count of items in each bin
+    std::vector<CountType> m_bins;
+
+    // Support
+    std::vector<uint32_t> m_Fields;
+    bool                  m_dumpBinsOnOutput;
+    bool                  m_includeOutOfBounds;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATFIXEDHISTOGRAM_H
@@ -16,25 +16,42 @@
 #include "sst/core/baseComponent.h"
 #include "sst/core/configGraph.h"
 #include "sst/core/output.h"
+#include "sst/core/serialization/serializer.h"
 #include "sst/core/statapi/statbase.h"
 #include "sst/core/statapi/statengine.h"
 #include "sst/core/statapi/statgroup.h"
 #include "sst/core/statapi/statoutput.h"
+#include "sst/core/threadsafe.h"
 
 #include <algorithm>
+#include <mutex>
 
 namespace SST {
 namespace Statistics {
 
+namespace {
+
+/** Identifies the same merged statistic on every rank */
+std::string
+getMergeKey(const StatisticBase* stat)
+{
+    return stat->getStatName() + "." + stat->getStatSubId() + "." + stat->getStatTypeName() + "." +
+           stat->getStatDataTypeShortName();
+}
+
+} // namespace
+
 StatisticGroup::StatisticGroup(const ConfigStatGroup& csg) :
     isDefault(false),
     name(csg.name),
     output(const_cast<StatisticOutput*>(StatisticProcessingEngine::getInstance()->getStatOutputs()[csg.outputID])),
     outputFreq(csg.outputFrequency),
+    merge(csg.mergeStats),
     components(csg.components)
 {
 
-    if ( !output->acceptsGroups() ) {
+    // Merged statistics can also be written as ordinary statistics
+    if ( !merge && !output->acceptsGroups() ) {
         Output::getDefaultObject().fatal(
             CALL_INFO, 1, "Statistic Output type %s cannot handle Statistic Groups\n",
             output->getStatisticOutputName().c_str());
@@ -72,5 +89,176 @@ StatisticGroup::addStatistic(StatisticBase* stat)
     stat->setGroup(this);
 }
 
+void
+StatisticGroup::addMergedStatistic(StatisticBase* stat, uint32_t thread)
+{
+    static Core::ThreadSafe::Spinlock           lock;
+    std::lock_guard<Core::ThreadSafe::Spinlock> guard(lock);
+
+    // Statistics with the same name, subid and type are merged together
+    size_t index = 0;
+    while ( index < stats.size() ) {
+        StatisticBase* merged = stats[index];
+        if ( merged->getStatName() == stat->getStatName() && merged->getStatSubId() == stat->getStatSubId() &&
+             merged->getStatTypeName() == stat->getStatTypeName() &&
+             merged->getStatDataType() == stat->getStatDataType() )
+            break;
+        index++;
+    }
+    if ( index < stats.size() ) {
+        // The merged data is only meaningful if the statistics are
+        // binned the same way
+        std::string mergedParams = stats[index]->getMergeParams();
+        std::string statParams   = stat->getMergeParams();
+        if ( mergedParams != statParams ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1,
+                "ERROR: Statistic %s (%s) can't be merged with the other %s statistics (%s) in statistic group %s\n",
+                stat->getFullStatName().c_str(), statParams.c_str(), stat->getStatName().c_str(),
+                mergedParams.c_str(), name.c_str());
+        }
+    }
+    else {
+        StatisticBase* merged = stat->createMergeTarget();
+        if ( nullptr == merged ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Statistic %s of type %s cannot be merged in statistic group %s\n",
+                stat->getFullStatName().c_str(), stat->getStatTypeName().c_str(), name.c_str());
+        }
+        merged->setMergedCompName(name);
+        merged->setRegisteredCollectionMode(stat->getRegisteredCollectionMode());
+        merged->setGroup(this);
+        stats.push_back(merged);
+    }
+
+    if ( threadStats.size() <= thread ) threadStats.resize(thread + 1);
+    threadStats[thread].stats.push_back(stat);
+    threadStats[thread].index.push_back(index);
+    stat->setGroup(this);
+}
+
+void
+StatisticGroup::mergeThreadStatistics(uint32_t thread, bool clearStats)
+{
+    if ( threadStats.size() <= thread ) return;
+    ThreadStats& ts = threadStats[thread];
+
+    // The partial results are created by the thread that uses them
+    while ( ts.partial.size() < stats.size() ) {
+        ts.partial.push_back(stats[ts.partial.size()]->createMergeTarget());
+    }
+    for ( StatisticBase* partial : ts.partial ) {
+        partial->clearStatisticData();
+        partial->setCollectionCount(0);
+    }
+
+    for ( size_t i = 0; i < ts.stats.size(); i++ ) {
+        StatisticBase* stat = ts.stats[i];
+        if ( !stat->isOutputEnabled() ) continue;
+        ts.partial[ts.index[i]]->mergeStatisticData(stat);
+
+        if ( clearStats ) {
+            // Check to see if the Statistic Count needs to be reset
+            if ( true == stat->getFlagResetCountOnOutput() ) { stat->resetCollectionCount(); }
+
+            // Check to see if the Statistic Data needs to be cleared
+            if ( true == stat->getFlagClearDataOnOutput() ) { stat->clearStatisticData(); }
+        }
+    }
+}
+
+void
+StatisticGroup::mergeThreadResults()
+{
+    for ( size_t i = 0; i < stats.size(); i++ ) {
+        stats[i]->clearStatisticData();
+        stats[i]->setCollectionCount(0);
+        for ( auto& ts : threadStats ) {
+            if ( i < ts.partial.size() ) stats[i]->mergeStatisticData(ts.partial[i]);
+        }
+    }
+}
+
+std::vector<char>
+StatisticGroup::packMergedStatistics()
+{
+    std::vector<std::string>       keys;
+    std::vector<std::string>       params;
+    std::vector<uint64_t>          counts;
+    std::vector<std::vector<char>> data;
+    for ( StatisticBase* stat : stats ) {
+        SST::Core::Serialization::serializer statSer;
+        statSer.start_sizing();
+        stat->serializeStatisticData(statSer);
+        data.emplace_back(statSer.size());
+        statSer.start_packing(data.back().data(), data.back().size());
+        stat->serializeStatisticData(statSer);
+
+        keys.push_back(getMergeKey(stat));
+        params.push_back(stat->getMergeParams());
+        counts.push_back(stat->getCollectionCount());
+    }
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_sizing();
+    ser& keys;
+    ser& params;
+    ser& counts;
+    ser& data;
+    std::vector<char> buffer(ser.size());
+    ser.start_packing(buffer.data(), buffer.size());
+    ser& keys;
+    ser& params;
+    ser& counts;
+    ser& data;
+    return buffer;
+}
+
+void
+StatisticGroup::mergePackedStatistics(std::vector<char>& buffer, int rank)
+{
+    std::vector<std::string>       keys;
+    std::vector<std::string>       params;
+    std::vector<uint64_t>          counts;
+    std::vector<std::vector<char>> data;
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(buffer.data(), buffer.size());
+    ser& keys;
+    ser& params;
+    ser& counts;
+    ser& data;
+
+    for ( size_t i = 0; i < keys.size(); i++ ) {
+        auto stat = std::find_if(
+            stats.begin(), stats.end(), [&keys, i](const StatisticBase* s) { return getMergeKey(s) == keys[i]; });
+
+        // There has to be a statistic here to merge into
+        if ( stat == stats.end() ) {
+            Output::getDefaultObject().output(
+                "WARNING: Statistic %s from rank %d is left out of merged statistic group %s\n", keys[i].c_str(),
+                rank, name.c_str());
+            continue;
+        }
+
+        std::string localParams = (*stat)->getMergeParams();
+        if ( localParams != params[i] ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1,
+                "ERROR: Statistic %s from rank %d (%s) can't be merged with the same statistic on this rank (%s) in "
+                "statistic group %s\n",
+                keys[i].c_str(), rank, params[i].c_str(), localParams.c_str(), name.c_str());
+        }
+
+        StatisticBase* remote = (*stat)->createMergeTarget();
+        remote->setCollectionCount(counts[i]);
+        SST::Core::Serialization::serializer statSer;
+        statSer.start_unpacking(data[i].data(), data[i].size());
+        remote->serializeStatisticData(statSer);
+        (*stat)->mergeStatisticData(remote);
+        delete remote;
+    }
+}
+
 } // namespace Statistics
 } // namespace SST
@@ -27,21 +27,72 @@ class StatisticOutput;
 class StatisticGroup
 {
 public:
-    StatisticGroup() : isDefault(true), name("default") {};
+    StatisticGroup() : isDefault(true), name("default"), merge(false) {};
     StatisticGroup(const ConfigStatGroup& csg);
 
     bool containsStatistic(const StatisticBase* stat) const;
     bool claimsStatistic(const StatisticBase* stat) const;
     void addStatistic(StatisticBase* stat);
 
+    /**
+     * Add a component's statistic to a merged group.  The statistic is
+     * merged with the statistics of the same name from the group's
+     * other components, which get a single entry in stats.  Only
+     * called before wireup is finished, so nothing is merging yet.
+     * @param stat - Statistic to add
+     * @param thread - Thread the statistic's component runs on
+     */
+    void addMergedStatistic(StatisticBase* stat, uint32_t thread);
+
+    /**
+     * Merge the statistics of the components on a thread into the
+     * thread's partial results.  Threads can do this in parallel.
+     * @param thread - Thread whose statistics to merge
+     * @param clearStats - Reset or clear the component statistics that
+     * are configured to be reset or cleared on output
+     */
+    void mergeThreadStatistics(uint32_t thread, bool clearStats);
+
+    /** Combine the partial results of all threads into stats */
+    void mergeThreadResults();
+
+    /** Pack the merged statistics so they can be merged on another rank */
+    std::vector<char> packMergedStatistics();
+
+    /**
+     * Merge statistics packed by packMergedStatistics() on another rank
+     * into stats.
+     * @param buffer - Packed statistics
+     * @param rank - Rank that packed them
+     */
+    void mergePackedStatistics(std::vector<char>& buffer, int rank);
+
     bool             isDefault;
     std::string      name;
     StatisticOutput* output;
     UnitAlgebra      outputFreq;
 
+    /** Statistics from all of the components are merged and output
+     * as one statistic per name.  Merged groups are only written by
+     * the group clock or at the end of simulation, and with more than
+     * one rank only at the end of simulation. */
+    bool merge;
+
     std::vector<ComponentId_t>  components;
     std::vector<std::string>    statNames;
     std::vector<StatisticBase*> stats;
+
+private:
+    /** The statistics of a merged group on one thread.  Each thread only
+     * touches its own partial results, so the merge can run in parallel. */
+    struct ThreadStats
+    {
+        std::vector<StatisticBase*> stats;   /*!< Component statistics */
+        std::vector<size_t>         index;   /*!< Entry in group stats for each statistic */
+        std::vector<StatisticBase*> partial; /*!< Partial result for each group stat */
+    };
+
+    std::vector<ThreadStats> threadStats;
 };
 
 } // namespace Statistics
@@ -17,6 +17,8 @@
 #include "sst/core/statapi/statoutput.h"
 #include "sst/core/warnmacros.h"
 
+#include <sstream>
+
 namespace SST {
 namespace Statistics {
 
@@ -223,6 +225,45 @@ private:
         this->setCollectionCount(0);
     }
 
+    StatisticBase* createMergeTarget() override
+    {
+        Params params = this->getParams();
+        return new HistogramStatistic<BinDataType>(
+            this->getComponent(), this->getStatName(), this->getStatSubId(), params);
+    }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        HistogramStatistic<BinDataType>* stat = static_cast<HistogramStatistic<BinDataType>*>(other);
+        m_totalSummed += stat->m_totalSummed;
+        m_totalSummedSqr += stat->m_totalSummedSqr;
+        m_OOBMinCount += stat->m_OOBMinCount;
+        m_OOBMaxCount += stat->m_OOBMaxCount;
+        m_itemsBinnedCount += stat->m_itemsBinnedCount;
+        for ( auto& bin : stat->m_binsMap ) {
+            m_binsMap[bin.first] += bin.second;
+        }
+        this->setCollectionCount(this->getCollectionCount() + stat->getCollectionCount());
+    }
+
+    std::string getMergeParams() const override
+    {
+        std::stringstream params;
+        params.precision(17);
+        params << "minvalue=" << +m_minValue << " binwidth=" << +m_binWidth << " numbins=" << +m_numBins;
+        return params.str();
+    }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_totalSummed;
+        ser& m_totalSummedSqr;
+        ser& m_OOBMinCount;
+        ser& m_OOBMaxCount;
+        ser& m_itemsBinnedCount;
+        ser& m_binsMap;
+    }
+
     void registerOutputFields(StatisticFieldsOutput* statOutput) override
     {
         // Check to see if we have registered the Startup Fields
@@ -0,0 +1,189 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATHYPERLOGLOG_H
+#define SST_CORE_STATAPI_STATHYPERLOGLOG_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class HyperLogLogStatistic
+
+    Estimates the number of unique values provided to it.  Unlike
+    UniqueCountStatistic, the values are not kept: each one is hashed
+    into one of 2^precision one byte registers, so memory is fixed and
+    the estimate has a standard error of about 1.04 / sqrt(2^precision)
+    (1.6% for the default precision of 12).
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+template <typename T>
+class HyperLogLogStatistic : public Statistic<T>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        HyperLogLogStatistic,
+        "sst",
+        "HyperLogLogStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Estimate unique occurrences of statistic in bounded memory",
+        "SST::Statistic<T>")
+
+    HyperLogLogStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<T>(comp, statName, statSubId, statParams)
+    {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "HyperLogLogStatistic values are hashed as 64-bit words");
+
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("precision");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        m_precision = statParams.find<uint32_t>("precision", 12);
+        m_precision = std::min<uint32_t>(std::max<uint32_t>(m_precision, 4), 18);
+        m_registers.resize(size_t(1) << m_precision, 0);
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("HyperLogLog");
+    }
+
+    ~HyperLogLogStatistic() {};
+
+protected:
+    /**
+    Present a new value to the Statistic to be included in the estimate
+        @param data New data item to be included in the estimate
+    */
+    void addData_impl(T data) override
+    {
+        // The top bits of the hash pick the register, which keeps the
+        // longest run of leading zeros seen in the rest
+        uint64_t hash  = hashValue(data);
+        size_t   index = hash >> (64 - m_precision);
+        uint64_t rest  = hash << m_precision;
+        uint8_t  rank  = (0 == rest) ? (64 - m_precision + 1) : (__builtin_clzll(rest) + 1);
+        if ( rank > m_registers[index] ) m_registers[index] = rank;
+    }
+
+    void addData_impl_Ntimes(uint64_t UNUSED(N), T data) override { addData_impl(data); }
+
+public:
+    /** @return The estimated number of unique values presented so far */
+    uint64_t getUniqueEstimate()
+    {
+        double m     = static_cast<double>(m_registers.size());
+        double sum   = 0;
+        size_t zeros = 0;
+        for ( uint8_t reg : m_registers ) {
+            sum += std::ldexp(1.0, -reg);
+            if ( 0 == reg ) zeros++;
+        }
+
+        double alpha;
+        switch ( m_registers.size() ) {
+        case 16:
+            alpha = 0.673;
+            break;
+        case 32:
+            alpha = 0.697;
+            break;
+        case 64:
+            alpha = 0.709;
+            break;
+        default:
+            alpha = 0.7213 / (1.0 + 1.079 / m);
+            break;
+        }
+
+        double estimate = alpha * m * m / sum;
+
+        // Linear counting is more accurate while registers are empty
+        if ( estimate <= 2.5 * m && zeros > 0 ) estimate = m * std::log(m / zeros);
+        return static_cast<uint64_t>(std::llround(estimate));
+    }
+
+    void clearStatisticData() override
+    {
+        std::fill(m_registers.begin(), m_registers.end(), 0);
+        this->setCollectionCount(0);
+    }
+
+    StatisticBase* createMergeTarget() override
+    {
+        Params params = this->getParams();
+        return new HyperLogLogStatistic<T>(this->getComponent(), this->getStatName(), this->getStatSubId(), params);
+    }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        // Statistics are only merged if getMergeParams() matches, so
+        // the registers line up
+        HyperLogLogStatistic<T>* stat = static_cast<HyperLogLogStatistic<T>*>(other);
+        for ( size_t i = 0; i < m_registers.size(); i++ ) {
+            m_registers[i] = std::max(m_registers[i], stat->m_registers[i]);
+        }
+        this->setCollectionCount(this->getCollectionCount() + stat->getCollectionCount());
+    }
+
+    std::string getMergeParams() const override { return "precision=" + std::to_string(m_precision); }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override { ser& m_registers; }
+
+private:
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        countField       = statOutput->registerField<uint64_t>("Count");
+        uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        statOutput->outputField(countField, this->getCollectionCount());
+        statOutput->outputField(uniqueCountField, getUniqueEstimate());
+    }
+
+    /** Hash the bits of a value.  Values that compare equal must hash
+     * the same, so -0.0 is hashed as 0.0. */
+    static uint64_t hashValue(T value)
+    {
+        if ( value == 0 ) value = 0;
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+
+        // splitmix64 finalizer, so every input bit affects the top bits
+        bits += 0x9e3779b97f4a7c15ULL;
+        bits = (bits ^ (bits >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        bits = (bits ^ (bits >> 27)) * 0x94d049bb133111ebULL;
+        return bits ^ (bits >> 31);
+    }
+
+    uint32_t                       m_precision;
+    std::vector<uint8_t>           m_registers;
+    StatisticOutput::fieldHandle_t countField;
+    StatisticOutput::fieldHandle_t uniqueCountField;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATHYPERLOGLOG_H
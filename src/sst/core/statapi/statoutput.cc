@@ -16,6 +16,7 @@
 #include "sst/core/output.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/statgroup.h"
+#include "sst/core/statapi/statoutputasync.h"
 #include "sst/core/stringize.h"
 
 namespace SST {
@@ -152,6 +153,10 @@ StatisticFieldsOutput::outputField(fieldHandle_t UNUSED(fieldHandle), uint64_t U
 void
 StatisticFieldsOutput::output(StatisticBase* statistic, bool endOfSimFlag)
 {
+    if ( m_asyncWriter ) {
+        m_asyncWriter->recordStatistic(statistic, endOfSimFlag);
+        return;
+    }
     this->lock();
     startOutputEntries(statistic);
     statistic->outputStatisticFields(this, endOfSimFlag);
@@ -159,6 +164,45 @@ StatisticFieldsOutput::output(StatisticBase* statistic, bool endOfSimFlag)
     this->unlock();
 }
 
+void
+StatisticFieldsOutput::outputGroup(StatisticGroup* group, bool endOfSimFlag)
+{
+    if ( m_asyncWriter ) {
+        m_asyncWriter->recordGroup(group, endOfSimFlag);
+        return;
+    }
+    StatisticOutput::outputGroup(group, endOfSimFlag);
+}
+
+SimTime_t
+StatisticFieldsOutput::getOutputSimCycle()
+{
+    if ( m_replaying ) return m_replayCycle;
+    return Simulation_impl::getSimulation()->getCurrentSimCycle();
+}
+
+int
+StatisticFieldsOutput::getOutputRank()
+{
+    if ( m_replaying ) return m_replayRank;
+    return Simulation_impl::getSimulation()->getRank().rank;
+}
+
+void
+StatisticFieldsOutput::startAsyncOutput(size_t max_queued_bytes)
+{
+    m_asyncWriter = new StatisticOutputAsyncWriter(this, max_queued_bytes);
+}
+
+void
+StatisticFieldsOutput::stopAsyncOutput()
+{
+    if ( nullptr == m_asyncWriter ) return;
+    m_asyncWriter->stop();
+    delete m_asyncWriter;
+    m_asyncWriter = nullptr;
+}
+
 void
 StatisticFieldsOutput::startRegisterGroup(StatisticGroup* UNUSED(group))
 {
@@ -208,9 +252,13 @@ StatisticFieldsOutput::getFieldTypeShortName(fieldType_t type)
 void
 StatisticFieldsOutput::registerStatistic(StatisticBase* stat)
 {
+    // Statistics can be registered during the simulation, so don't
+    // change the fields while an asynchronous writer is using them
+    this->lock();
     startRegisterFields(stat);
     stat->registerOutputFields(this);
     stopRegisterFields();
+    this->unlock();
 }
 
 // Start / Stop of register
@@ -34,6 +34,7 @@ class Simulation;
 namespace Statistics {
 class StatisticProcessingEngine;
 class StatisticGroup;
+class StatisticOutputAsyncWriter;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -59,7 +60,7 @@ public:
     using FieldNameMap_t   = std::unordered_map<std::string, fieldHandle_t>;
 
 public:
-    ~StatisticOutput();
+    virtual ~StatisticOutput();
 
     /** Return the Statistic Output name */
     std::string& getStatisticOutputName() { return m_statOutputName; }
@@ -107,12 +108,14 @@ protected:
      * Allows object to perform any shutdown required. */
     virtual void endOfSimulation() = 0;
 
+    /** Output all of the statistics in a group */
+    virtual void outputGroup(StatisticGroup* group, bool endOfSimFlag);
+
 private:
     // Start / Stop of register Fields
     virtual void registerStatistic(StatisticBase* stat) = 0;
 
     void registerGroup(StatisticGroup* group);
-    void outputGroup(StatisticGroup* group, bool endOfSimFlag);
 
     virtual void startOutputGroup(StatisticGroup* group) = 0;
     virtual void stopOutputGroup()                       = 0;
@@ -261,7 +264,28 @@ protected:
     // For Serialization
     StatisticFieldsOutput() {}
 
+    void outputGroup(StatisticGroup* group, bool endOfSimFlag) override;
+
+    /** Return the simulation cycle to label the current output with.
+     * When output is written asynchronously, this is the cycle at which
+     * the statistic was output, not the current cycle. */
+    SimTime_t getOutputSimCycle();
+
+    /** Return the rank to label the current output with */
+    int getOutputRank();
+
 private:
+    friend class SST::Statistics::StatisticProcessingEngine;
+    friend class SST::Statistics::StatisticOutputAsyncWriter;
+
+    /** Start writing output on a separate thread.  Output is recorded
+     * and buffered until the writer thread gets to it, with at most
+     * max_queued_bytes waiting at a time. */
+    void startAsyncOutput(size_t max_queued_bytes);
+
+    /** Write any buffered output and stop the writer thread */
+    void stopAsyncOutput();
+
     // Other support functions
     StatisticFieldInfo* addFieldToLists(const char* fieldName, fieldType_t fieldType);
     fieldHandle_t       generateFieldHandle(StatisticFieldInfo* FieldInfo);
@@ -272,6 +296,12 @@ private:
     fieldHandle_t    m_highestFieldHandle;
     std::string      m_currentFieldStatName;
 
+    // Asynchronous output
+    StatisticOutputAsyncWriter* m_asyncWriter = nullptr;
+    bool                        m_replaying   = false;
+    SimTime_t                   m_replayCycle = 0;
+    int                         m_replayRank  = 0;
+
 protected:
     /** These can be overriden, if necessary, but must be callable
      *  by the derived class */
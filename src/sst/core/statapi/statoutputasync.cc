@@ -0,0 +1,264 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputasync.h"
+
+#include "sst/core/cputimer.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/statapi/statgroup.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace Statistics {
+
+const size_t StatisticOutputAsyncWriter::max_chunk_size;
+
+StatisticOutputAsyncWriter::StatisticOutputAsyncWriter(StatisticFieldsOutput* target, size_t max_queued_bytes) :
+    StatisticFieldsOutput(target->getOutputParameters()),
+    m_target(target),
+    m_maxQueuedBytes(max_queued_bytes),
+    // Keep several buffers in flight so the writer can work while the
+    // simulation fills the next one
+    m_chunkSize(std::max<size_t>(std::min(max_chunk_size, max_queued_bytes / 4), 1)),
+    m_queuedBytes(0),
+    m_done(false),
+    m_totalBytes(0),
+    m_stallCount(0),
+    m_stallTime(0.0)
+{
+    setStatisticOutputName(target->getStatisticOutputName() + " (async)");
+
+    // The writer thread can't ask the simulation for the rank
+    m_target->m_replayRank = Simulation_impl::getSimulation()->getRank().rank;
+
+    m_current.reserve(m_chunkSize);
+    m_thread = std::thread(&StatisticOutputAsyncWriter::run, this);
+}
+
+StatisticOutputAsyncWriter::~StatisticOutputAsyncWriter()
+{
+    if ( m_thread.joinable() ) stop();
+}
+
+void
+StatisticOutputAsyncWriter::recordStatistic(StatisticBase* statistic, bool endOfSimFlag)
+{
+    std::lock_guard<std::mutex> lock(m_recordLock);
+    appendStatistic(statistic, endOfSimFlag);
+    if ( m_current.size() >= m_chunkSize ) flush();
+}
+
+void
+StatisticOutputAsyncWriter::recordGroup(StatisticGroup* group, bool endOfSimFlag)
+{
+    std::lock_guard<std::mutex> lock(m_recordLock);
+    append(START_GROUP);
+    append(group);
+    append(Simulation_impl::getSimulation()->getCurrentSimCycle());
+    for ( auto& stat : group->stats ) {
+        appendStatistic(stat, endOfSimFlag);
+    }
+    append(STOP_GROUP);
+    if ( m_current.size() >= m_chunkSize ) flush();
+}
+
+void
+StatisticOutputAsyncWriter::appendStatistic(StatisticBase* statistic, bool endOfSimFlag)
+{
+    append(START_ENTRIES);
+    append(statistic);
+    append(Simulation_impl::getSimulation()->getCurrentSimCycle());
+    // The statistic writes its fields to this object, which records
+    // them instead of formatting them
+    statistic->outputStatisticFields(this, endOfSimFlag);
+    append(STOP_ENTRIES);
+}
+
+void
+StatisticOutputAsyncWriter::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    appendField(FIELD_INT32, fieldHandle, data);
+}
+
+void
+StatisticOutputAsyncWriter::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    appendField(FIELD_UINT32, fieldHandle, data);
+}
+
+void
+StatisticOutputAsyncWriter::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    appendField(FIELD_INT64, fieldHandle, data);
+}
+
+void
+StatisticOutputAsyncWriter::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    appendField(FIELD_UINT64, fieldHandle, data);
+}
+
+void
+StatisticOutputAsyncWriter::outputField(fieldHandle_t fieldHandle, float data)
+{
+    appendField(FIELD_FLOAT, fieldHandle, data);
+}
+
+void
+StatisticOutputAsyncWriter::outputField(fieldHandle_t fieldHandle, double data)
+{
+    appendField(FIELD_DOUBLE, fieldHandle, data);
+}
+
+void
+StatisticOutputAsyncWriter::flush()
+{
+    if ( m_current.empty() ) return;
+
+    size_t                       size = m_current.size();
+    std::unique_lock<std::mutex> lock(m_queueLock);
+    // Always let at least one buffer through so a single buffer larger
+    // than the limit can't wait forever
+    if ( m_queuedBytes > 0 && m_queuedBytes + size > m_maxQueuedBytes ) {
+        double start = sst_get_cpu_time();
+        m_spaceCV.wait(lock, [&]() { return m_queuedBytes == 0 || m_queuedBytes + size <= m_maxQueuedBytes; });
+        m_stallTime += sst_get_cpu_time() - start;
+        m_stallCount++;
+    }
+    m_queuedBytes += size;
+    m_totalBytes += size;
+    m_queue.push_back(std::move(m_current));
+    lock.unlock();
+    m_queueCV.notify_one();
+
+    m_current = std::vector<char>();
+    m_current.reserve(m_chunkSize);
+}
+
+void
+StatisticOutputAsyncWriter::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_recordLock);
+        flush();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queueLock);
+        m_done = true;
+    }
+    m_queueCV.notify_one();
+    m_thread.join();
+
+    Output::getDefaultObject().verbose(
+        CALL_INFO, 1, 0,
+        "%s: wrote %" PRIu64 " bytes of recorded output, simulation waited %" PRIu64 " times for %lg seconds\n",
+        getStatisticOutputName().c_str(), m_totalBytes, m_stallCount, m_stallTime);
+}
+
+void
+StatisticOutputAsyncWriter::run()
+{
+    std::unique_lock<std::mutex> lock(m_queueLock);
+    while ( true ) {
+        m_queueCV.wait(lock, [this]() { return !m_queue.empty() || m_done; });
+        if ( m_queue.empty() ) break;
+
+        std::vector<char> chunk = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+
+        replay(chunk);
+
+        lock.lock();
+        m_queuedBytes -= chunk.size();
+        m_spaceCV.notify_all();
+    }
+}
+
+void
+StatisticOutputAsyncWriter::replay(const std::vector<char>& chunk)
+{
+    m_target->lock();
+    m_target->m_replaying = true;
+
+    size_t pos = 0;
+    while ( pos < chunk.size() ) {
+        RecordType type = read<RecordType>(chunk, pos);
+        switch ( type ) {
+        case START_ENTRIES:
+        {
+            StatisticBase* statistic = read<StatisticBase*>(chunk, pos);
+            m_target->m_replayCycle  = read<SimTime_t>(chunk, pos);
+            m_target->startOutputEntries(statistic);
+            break;
+        }
+        case STOP_ENTRIES:
+            m_target->stopOutputEntries();
+            break;
+        case START_GROUP:
+        {
+            StatisticGroup* group   = read<StatisticGroup*>(chunk, pos);
+            m_target->m_replayCycle = read<SimTime_t>(chunk, pos);
+            m_target->startOutputGroup(group);
+            break;
+        }
+        case STOP_GROUP:
+            m_target->stopOutputGroup();
+            break;
+        case FIELD_INT32:
+        {
+            fieldHandle_t handle = read<fieldHandle_t>(chunk, pos);
+            m_target->outputField(handle, read<int32_t>(chunk, pos));
+            break;
+        }
+        case FIELD_UINT32:
+        {
+            fieldHandle_t handle = read<fieldHandle_t>(chunk, pos);
+            m_target->outputField(handle, read<uint32_t>(chunk, pos));
+            break;
+        }
+        case FIELD_INT64:
+        {
+            fieldHandle_t handle = read<fieldHandle_t>(chunk, pos);
+            m_target->outputField(handle, read<int64_t>(chunk, pos));
+            break;
+        }
+        case FIELD_UINT64:
+        {
+            fieldHandle_t handle = read<fieldHandle_t>(chunk, pos);
+            m_target->outputField(handle, read<uint64_t>(chunk, pos));
+            break;
+        }
+        case FIELD_FLOAT:
+        {
+            fieldHandle_t handle = read<fieldHandle_t>(chunk, pos);
+            m_target->outputField(handle, read<float>(chunk, pos));
+            break;
+        }
+        case FIELD_DOUBLE:
+        {
+            fieldHandle_t handle = read<fieldHandle_t>(chunk, pos);
+            m_target->outputField(handle, read<double>(chunk, pos));
+            break;
+        }
+        }
+    }
+
+    m_target->m_replaying = false;
+    m_target->unlock();
+}
+
+} // namespace Statistics
+} // namespace SST
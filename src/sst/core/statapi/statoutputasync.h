@@ -0,0 +1,152 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTASYNC_H
+#define SST_CORE_STATAPI_STATOUTPUTASYNC_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statoutput.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputAsyncWriter
+
+  Moves the formatting and file I/O of a StatisticFieldsOutput off the
+  simulation threads.  When a statistic is output, its field values
+  are copied into an in-memory record buffer.  Full buffers are handed
+  to a writer thread, which replays them into the real output in the
+  order they were recorded.  The amount of recorded data waiting for
+  the writer is bounded; a simulation thread that would go over the
+  bound waits for the writer to catch up.
+*/
+class StatisticOutputAsyncWriter : public StatisticFieldsOutput
+{
+public:
+    /** Construct a writer for an output and start the writer thread
+     * @param target - The output the recorded data is written to
+     * @param max_queued_bytes - Maximum bytes of recorded data waiting for the writer thread
+     */
+    StatisticOutputAsyncWriter(StatisticFieldsOutput* target, size_t max_queued_bytes);
+    ~StatisticOutputAsyncWriter() override;
+
+    /** Record the current field values of a statistic */
+    void recordStatistic(StatisticBase* statistic, bool endOfSimFlag);
+
+    /** Record the current field values of all statistics in a group */
+    void recordGroup(StatisticGroup* group, bool endOfSimFlag);
+
+    /** Write everything that has been recorded and stop the writer
+     * thread.  Must be called before the target's endOfSimulation(). */
+    void stop();
+
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+protected:
+    bool checkOutputParameters() override { return true; }
+    void printUsage() override {}
+    void startOfSimulation() override {}
+    void endOfSimulation() override {}
+    void implStartOutputEntries(StatisticBase* UNUSED(statistic)) override {}
+    void implStopOutputEntries() override {}
+
+private:
+    enum RecordType : uint8_t {
+        START_ENTRIES,
+        STOP_ENTRIES,
+        START_GROUP,
+        STOP_GROUP,
+        FIELD_INT32,
+        FIELD_UINT32,
+        FIELD_INT64,
+        FIELD_UINT64,
+        FIELD_FLOAT,
+        FIELD_DOUBLE
+    };
+
+    template <typename T>
+    void append(const T& val)
+    {
+        size_t pos = m_current.size();
+        m_current.resize(pos + sizeof(T));
+        std::memcpy(m_current.data() + pos, &val, sizeof(T));
+    }
+
+    template <typename T>
+    T read(const std::vector<char>& chunk, size_t& pos)
+    {
+        T val;
+        std::memcpy(&val, chunk.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return val;
+    }
+
+    template <typename T>
+    void appendField(RecordType type, fieldHandle_t fieldHandle, T data)
+    {
+        append(type);
+        append(fieldHandle);
+        append(data);
+    }
+
+    void appendStatistic(StatisticBase* statistic, bool endOfSimFlag);
+
+    /** Hand the current record buffer to the writer thread.  Called
+     * with m_recordLock held. */
+    void flush();
+
+    /** Writer thread main loop */
+    void run();
+
+    /** Write the records in a buffer to the target */
+    void replay(const std::vector<char>& chunk);
+
+    static const size_t max_chunk_size = 64 * 1024;
+
+    StatisticFieldsOutput* m_target;
+    size_t                 m_maxQueuedBytes;
+    size_t                 m_chunkSize;
+
+    // Buffer the simulation threads are recording into
+    std::mutex        m_recordLock;
+    std::vector<char> m_current;
+
+    // Buffers waiting for the writer thread
+    std::mutex                    m_queueLock;
+    std::condition_variable       m_queueCV;
+    std::condition_variable       m_spaceCV;
+    std::deque<std::vector<char>> m_queue;
+    size_t                        m_queuedBytes;
+    bool                          m_done;
+    std::thread                   m_thread;
+
+    uint64_t m_totalBytes;
+    uint64_t m_stallCount;
+    double   m_stallTime;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTASYNC_H
@@ -0,0 +1,271 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputbinary.h"
+
+#include "sst/core/simulation_impl.h"
+
+namespace SST {
+namespace Statistics {
+
+StatisticOutputBinary::StatisticOutputBinary(Params& outputParameters) :
+    StatisticFieldsOutput(outputParameters),
+    m_hFile(nullptr)
+{
+    // Announce this output object's name
+    Output& out = Simulation_impl::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputBinary enabled...\n");
+    setStatisticOutputName("StatisticOutputBinary");
+}
+
+bool
+StatisticOutputBinary::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if ( true == foundKey ) { return false; }
+
+    // Get the parameters
+    m_FilePath     = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.sstb");
+    m_maxBlockRows = getOutputParameters().find<uint64_t>("blockrows", 65536);
+
+    if ( 0 == m_FilePath.length() ) {
+        // Filepath is zero length
+        return false;
+    }
+    if ( 0 == m_maxBlockRows ) { return false; }
+
+    return true;
+}
+
+void
+StatisticOutputBinary::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Sends all statistic output to a binary columnar file.\n");
+    out.output(" : Use sst-stat-convert to convert the file to CSV.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : filepath = <Path to output file> - Default is ./StatisticOutput.sstb\n");
+    out.output(" : blockrows = <Maximum rows in a block> - Default is 65536\n");
+}
+
+void
+StatisticOutputBinary::startOfSimulation()
+{
+    // Set Filename with Rank if Num Ranks > 1
+    if ( 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
+        int         rank    = Simulation_impl::getSimulation()->getRank().rank;
+        std::string rankstr = "_" + std::to_string(rank);
+
+        // Search for any extension
+        size_t index = m_FilePath.find_last_of(".");
+        if ( std::string::npos != index ) {
+            // We found a . at the end of the file, insert the rank string
+            m_FilePath.insert(index, rankstr);
+        }
+        else {
+            // No . found, append the rank string
+            m_FilePath += rankstr;
+        }
+    }
+
+    m_hFile = fopen(m_FilePath.c_str(), "wb");
+    if ( nullptr == m_hFile ) {
+        // We got an error of some sort
+        Output out = Simulation_impl::getSimulation()->getSimulationOutput();
+        out.fatal(
+            CALL_INFO, 1, " : StatisticOutputBinary - Problem opening File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+        return;
+    }
+    // Blocks are written a column at a time, so use a large buffer
+    m_fileBuffer.resize(1024 * 1024);
+    setvbuf(m_hFile, m_fileBuffer.data(), _IOFBF, m_fileBuffer.size());
+
+    fwrite(BinaryFormat::magic, sizeof(BinaryFormat::magic), 1, m_hFile);
+    write(BinaryFormat::version);
+    write(BinaryFormat::endian_check);
+    write(static_cast<int32_t>(getOutputRank()));
+    write(static_cast<uint32_t>(getFieldInfoArray().size()));
+
+    for ( StatisticFieldInfo* statField : getFieldInfoArray() ) {
+        fieldType_t             type = statField->getFieldType();
+        BinaryFormat::FieldType binaryType;
+        if ( type == StatisticFieldType<int32_t>::id() )
+            binaryType = BinaryFormat::INT32;
+        else if ( type == StatisticFieldType<uint32_t>::id() )
+            binaryType = BinaryFormat::UINT32;
+        else if ( type == StatisticFieldType<int64_t>::id() )
+            binaryType = BinaryFormat::INT64;
+        else if ( type == StatisticFieldType<uint64_t>::id() )
+            binaryType = BinaryFormat::UINT64;
+        else if ( type == StatisticFieldType<float>::id() )
+            binaryType = BinaryFormat::FLOAT;
+        else if ( type == StatisticFieldType<double>::id() )
+            binaryType = BinaryFormat::DOUBLE;
+        else {
+            Simulation_impl::getSimulationOutput().fatal(
+                CALL_INFO, 1, " : StatisticOutputBinary - Field %s has unsupported type %s\n",
+                statField->getFieldName().c_str(), getFieldTypeShortName(type));
+            return;
+        }
+
+        Column col;
+        col.type  = binaryType;
+        col.width = BinaryFormat::fieldWidth(binaryType);
+        m_columns.push_back(col);
+
+        write(static_cast<uint8_t>(binaryType));
+        writeString(statField->getFieldName());
+        writeString(getFieldTypeShortName(type));
+    }
+}
+
+void
+StatisticOutputBinary::endOfSimulation()
+{
+    if ( nullptr == m_hFile ) return;
+    writeBlock();
+    fclose(m_hFile);
+    m_hFile = nullptr;
+}
+
+void
+StatisticOutputBinary::implStartOutputEntries(StatisticBase* statistic)
+{
+    // Start a new block for each output time
+    SimTime_t time = getOutputSimCycle();
+    if ( !m_timeColumn.empty() && (m_timeColumn.front() != time || m_timeColumn.size() >= m_maxBlockRows) ) {
+        writeBlock();
+    }
+
+    auto     iter = m_statIndex.find(statistic);
+    uint32_t index;
+    if ( iter == m_statIndex.end() ) {
+        index                  = m_statIndex.size();
+        m_statIndex[statistic] = index;
+        m_newStats.push_back(statistic);
+    }
+    else {
+        index = iter->second;
+    }
+
+    // Fields the statistic doesn't output are left as zero and
+    // marked as not valid
+    size_t row = m_timeColumn.size();
+    for ( auto& col : m_columns ) {
+        if ( row % 8 == 0 ) col.valid.push_back(0);
+        col.data.resize(col.data.size() + col.width, 0);
+    }
+    m_timeColumn.push_back(time);
+    m_statColumn.push_back(index);
+}
+
+void
+StatisticOutputBinary::implStopOutputEntries()
+{
+    // Nothing to do, the row is complete
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, float data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, double data)
+{
+    setField(fieldHandle, data);
+}
+
+StatisticOutputBinary::Column&
+StatisticOutputBinary::getColumn(fieldHandle_t fieldHandle)
+{
+    if ( fieldHandle < 0 || static_cast<size_t>(fieldHandle) >= m_columns.size() ) {
+        StatisticFieldInfo* statField = getRegisteredField(fieldHandle);
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1,
+            " : StatisticOutputBinary - Field %s.%s has no column, fields must be registered before the start of "
+            "simulation\n",
+            statField ? statField->getStatName().c_str() : "<unknown>",
+            statField ? statField->getFieldName().c_str() : "<unknown>");
+    }
+    return m_columns[fieldHandle];
+}
+
+void
+StatisticOutputBinary::writeString(const std::string& str)
+{
+    write(static_cast<uint32_t>(str.size()));
+    fwrite(str.data(), 1, str.size(), m_hFile);
+}
+
+void
+StatisticOutputBinary::writeBlock()
+{
+    if ( m_timeColumn.empty() ) return;
+
+    write(BinaryFormat::block_tag);
+    write(static_cast<uint32_t>(m_newStats.size()));
+    for ( StatisticBase* stat : m_newStats ) {
+        writeString(stat->getCompName());
+        writeString(stat->getStatName());
+        writeString(stat->getStatSubId());
+        writeString(stat->getStatTypeName());
+    }
+    m_newStats.clear();
+
+    write(static_cast<uint64_t>(m_timeColumn.size()));
+    fwrite(m_timeColumn.data(), sizeof(uint64_t), m_timeColumn.size(), m_hFile);
+    fwrite(m_statColumn.data(), sizeof(uint32_t), m_statColumn.size(), m_hFile);
+    for ( auto& col : m_columns ) {
+        fwrite(col.valid.data(), 1, col.valid.size(), m_hFile);
+        fwrite(col.data.data(), 1, col.data.size(), m_hFile);
+        col.valid.clear();
+        col.data.clear();
+    }
+    m_timeColumn.clear();
+    m_statColumn.clear();
+}
+
+} // namespace Statistics
+} // namespace SST
@@ -0,0 +1,177 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTBINARY_H
+#define SST_CORE_STATAPI_STATOUTPUTBINARY_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbinaryformat.h"
+#include "sst/core/statapi/statoutput.h"
+
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputBinary
+
+    The class for statistics output to a binary columnar file.  Field
+    values are stored in fixed width columns, one block of rows per
+    output time, instead of being formatted as text.  The file layout
+    is described in statbinaryformat.h; sst-stat-convert turns the file
+    into the same CSV that sst.statOutputCSV writes.
+*/
+class StatisticOutputBinary : public StatisticFieldsOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        StatisticOutput,
+        StatisticOutputBinary,
+        "sst",
+        "statoutputbinary",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Output to a binary columnar file")
+
+    /** Construct a StatOutputBinary
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputBinary(Params& outputParameters);
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    /** Indicate to Statistic Output that simulation started.
+     *  Statistic output may perform any startup code here as necessary.
+     */
+    void startOfSimulation() override;
+
+    /** Indicate to Statistic Output that simulation ended.
+     *  Statistic output may perform any shutdown code here as necessary.
+     */
+    void endOfSimulation() override;
+
+    /** Implementation function for the start of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is about to send data to the Statistic Output for processing.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is finished sending data to the Statistic Output for processing.
+     * The Statistic Output can perform any output related functions here.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+protected:
+    StatisticOutputBinary() { ; } // For serialization
+
+private:
+    struct Column
+    {
+        BinaryFormat::FieldType type;
+        size_t                  width;
+        std::vector<uint8_t>    valid;
+        std::vector<char>       data;
+    };
+
+    /** Store a value in the current row of a column, converting it to
+     * the type the column was registered with */
+    template <typename T>
+    void setField(fieldHandle_t fieldHandle, T data)
+    {
+        Column& col = getColumn(fieldHandle);
+        char*   loc = col.data.data() + col.data.size() - col.width;
+        size_t  row = m_timeColumn.size() - 1;
+        col.valid[row / 8] |= 1 << (row % 8);
+        switch ( col.type ) {
+        case BinaryFormat::INT32:
+            store(loc, static_cast<int32_t>(data));
+            break;
+        case BinaryFormat::UINT32:
+            store(loc, static_cast<uint32_t>(data));
+            break;
+        case BinaryFormat::INT64:
+            store(loc, static_cast<int64_t>(data));
+            break;
+        case BinaryFormat::UINT64:
+            store(loc, static_cast<uint64_t>(data));
+            break;
+        case BinaryFormat::FLOAT:
+            store(loc, static_cast<float>(data));
+            break;
+        case BinaryFormat::DOUBLE:
+            store(loc, static_cast<double>(data));
+            break;
+        }
+    }
+
+    /** Returns the column for a field.  The columns are fixed at the
+     * start of simulation, so fields registered later don't have one. */
+    Column& getColumn(fieldHandle_t fieldHandle);
+
+    template <typename T>
+    static void store(char* loc, T data)
+    {
+        memcpy(loc, &data, sizeof(T));
+    }
+
+    template <typename T>
+    void write(const T& data)
+    {
+        fwrite(&data, sizeof(T), 1, m_hFile);
+    }
+
+    void writeString(const std::string& str);
+
+    /** Write the rows collected so far as a block */
+    void writeBlock();
+
+    FILE*                                        m_hFile;
+    std::string                                  m_FilePath;
+    uint64_t                                     m_maxBlockRows;
+    std::vector<char>                            m_fileBuffer;
+    std::unordered_map<StatisticBase*, uint32_t> m_statIndex;
+    std::vector<StatisticBase*>                  m_newStats;
+    std::vector<Column>                          m_columns;
+    std::vector<uint64_t>                        m_timeColumn;
+    std::vector<uint32_t>                        m_statColumn;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTBINARY_H
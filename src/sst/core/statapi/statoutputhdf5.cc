@@ -21,13 +21,41 @@
 #include "sst/core/warnmacros.h"
 
 #include <algorithm>
+#include <cstring>
+
+#if defined(SST_CONFIG_HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+#include "sst/core/objectComms.h"
+#endif
 
 namespace SST {
 namespace Statistics {
 
+/** Transfer properties for writing datasets.  In collective mode the
+ * MPI-IO layer combines the rows from every rank into one write. */
+static const H5::DSetMemXferPropList&
+getTransferProps(bool collective)
+{
+#if defined(SST_CONFIG_HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+    static H5::DSetMemXferPropList collectiveProps;
+    static bool                    initialized = false;
+    if ( collective ) {
+        if ( !initialized ) {
+            H5Pset_dxpl_mpio(collectiveProps.getId(), H5FD_MPIO_COLLECTIVE);
+            initialized = true;
+        }
+        return collectiveProps;
+    }
+#else
+    static_cast<void>(collective);
+#endif
+    return H5::DSetMemXferPropList::DEFAULT;
+}
+
 StatisticOutputHDF5::StatisticOutputHDF5(Params& outputParameters) :
     StatisticFieldsOutput(outputParameters),
     m_hFile(nullptr),
+    m_collective(false),
+    m_rank(0),
     m_currentDataSet(nullptr)
 {
     // Announce this output object's name
@@ -58,6 +86,51 @@ StatisticOutputHDF5::checkOutputParameters()
 
     H5::Exception::dontPrint();
 
+    RankInfo numRanks = Simulation_impl::getSimulation()->getNumRanks();
+    RankInfo myRank   = Simulation_impl::getSimulation()->getRank();
+    m_rank            = myRank.rank;
+
+    m_collective = getOutputParameters().find<bool>("collective", false) && numRanks.rank > 1;
+    if ( m_collective ) {
+#if defined(SST_CONFIG_HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+        // MPI is only initialized for the main thread, so the
+        // collective writes can't be moved to the async writer thread
+        if ( Simulation_impl::getSimulation()->async_stat_output ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "StatisticOutputHDF5 collective output cannot be used with --async-stat-output\n");
+        }
+
+        // Every rank opens the same file
+        H5::FileAccPropList accessProps;
+        H5Pset_fapl_mpio(accessProps.getId(), MPI_COMM_WORLD, MPI_INFO_NULL);
+        m_hFile = new H5::H5File(m_filePath, H5F_ACC_TRUNC, H5::FileCreatPropList::DEFAULT, accessProps);
+        return true;
+#else
+        if ( 0 == myRank.rank ) {
+            Simulation_impl::getSimulationOutput().output(
+                "WARNING: StatisticOutputHDF5 needs an HDF5 library with parallel support for collective output, "
+                "writing one file per rank instead\n");
+        }
+        m_collective = false;
+#endif
+    }
+
+    // Set Filename with Rank if Num Ranks > 1
+    if ( 1 < numRanks.rank ) {
+        std::string rankstr = "_" + std::to_string(myRank.rank);
+
+        // Search for any extension
+        size_t index = m_filePath.find_last_of(".");
+        if ( std::string::npos != index ) {
+            // We found a . at the end of the file, insert the rank string
+            m_filePath.insert(index, rankstr);
+        }
+        else {
+            // No . found, append the rank string
+            m_filePath += rankstr;
+        }
+    }
+
     m_hFile = new H5::H5File(m_filePath, H5F_ACC_TRUNC);
 
     return true;
@@ -72,6 +145,7 @@ StatisticOutputHDF5::printUsage()
     out.output(" : Parameters:\n");
     out.output(" : help = Force Statistic Output to display usage\n");
     out.output(" : filepath = <Path to .h5 file> - Default is ./StatisticOutput.h5\n");
+    out.output(" : collective = 0 | 1 - Write all ranks to one file, statistic groups only - Default is 0\n");
 }
 
 void
@@ -80,6 +154,14 @@ StatisticOutputHDF5::startRegisterFields(StatisticBase* stat)
     StatisticFieldsOutput::startRegisterFields(stat);
     if ( m_currentDataSet != nullptr ) { m_currentDataSet->setCurrentStatistic(stat); }
     else {
+        // Each rank has different statistics, so only groups have
+        // datasets that every rank can create together
+        if ( m_collective ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1,
+                "StatisticOutputHDF5 collective output only writes statistic groups, statistic %s is not in one\n",
+                stat->getFullStatName().c_str());
+        }
         m_currentDataSet = initStatistic(stat);
     }
 }
@@ -103,8 +185,16 @@ void
 StatisticOutputHDF5::startRegisterGroup(StatisticGroup* group)
 {
     StatisticFieldsOutput::startRegisterGroup(group);
+
+    // Merged groups are only written by one rank
+    if ( m_collective && group->merge ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "StatisticOutputHDF5 collective output cannot write merged statistic group %s\n",
+            group->name.c_str());
+    }
     m_statGroups.emplace(
-        std::piecewise_construct, std::forward_as_tuple(group->name), std::forward_as_tuple(group, m_hFile));
+        std::piecewise_construct, std::forward_as_tuple(group->name),
+        std::forward_as_tuple(group, m_hFile, m_collective, m_rank));
     m_currentDataSet = &m_statGroups.at(group->name);
     m_currentDataSet->beginGroupRegistration(group);
 }
@@ -127,6 +217,8 @@ StatisticOutputHDF5::endOfSimulation()
     for ( auto i : m_statistics ) {
         delete i.second;
     }
+    // The group datasets have to be closed before the file
+    m_statGroups.clear();
     delete m_hFile;
 }
 
@@ -134,7 +226,7 @@ void
 StatisticOutputHDF5::implStartOutputEntries(StatisticBase* statistic)
 {
     if ( m_currentDataSet == nullptr ) m_currentDataSet = getStatisticInfo(statistic);
-    m_currentDataSet->startNewEntry(statistic);
+    m_currentDataSet->startNewEntry(statistic, getOutputSimCycle());
 }
 
 void
@@ -149,7 +241,7 @@ StatisticOutputHDF5::startOutputGroup(StatisticGroup* group)
 {
     StatisticFieldsOutput::startOutputGroup(group);
     m_currentDataSet = &m_statGroups.at(group->name);
-    m_currentDataSet->startNewGroupEntry();
+    m_currentDataSet->startNewGroupEntry(getOutputSimCycle());
 }
 
 void
@@ -211,12 +303,12 @@ StatisticOutputHDF5::getStatisticInfo(StatisticBase* statistic)
 }
 
 void
-StatisticOutputHDF5::StatisticInfo::startNewEntry(StatisticBase* UNUSED(stat))
+StatisticOutputHDF5::StatisticInfo::startNewEntry(StatisticBase* UNUSED(stat), SimTime_t time)
 {
     for ( StatData_u& i : currentData ) {
         memset(&i, '\0', sizeof(i));
     }
-    currentData[0].u64 = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    currentData[0].u64 = time;
 }
 
 StatisticOutputHDF5::StatData_u&
@@ -331,10 +423,12 @@ StatisticOutputHDF5::StatisticInfo::finalizeCurrentStatistic()
     fieldNames.clear();
 }
 
-StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup* group, H5::H5File* file) :
-    DataSet(file),
+StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup* group, H5::H5File* file, bool collective, int rank) :
+    DataSet(file, collective),
     nEntries(0),
-    m_statGroup(group)
+    m_statGroup(group),
+    timeDataSet(nullptr),
+    m_rank(rank)
 {
     /* We need to store component pointers, not just IDs */
     m_components.resize(m_statGroup->components.size());
@@ -351,13 +445,19 @@ StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup* group, H5::H5File* fil
     }
 }
 
+StatisticOutputHDF5::GroupInfo::~GroupInfo()
+{
+    if ( timeDataSet ) delete timeDataSet;
+}
+
 void
 StatisticOutputHDF5::GroupInfo::setCurrentStatistic(StatisticBase* stat)
 {
     std::string statName = GroupStat::getStatName(stat);
     if ( m_statGroups.find(statName) == m_statGroups.end() ) {
         m_statGroups.emplace(
-            std::piecewise_construct, std::forward_as_tuple(statName), std::forward_as_tuple(this, stat));
+            std::piecewise_construct, std::forward_as_tuple(statName),
+            std::forward_as_tuple(this, stat->getStatName(), stat->getStatSubId()));
     }
     m_currentStat = &(m_statGroups.at(statName));
 
@@ -397,6 +497,8 @@ StatisticOutputHDF5::GroupInfo::finalizeCurrentStatistic()
 void
 StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
 {
+    if ( isCollective() ) unifyRegistration();
+
     for ( auto& stat : m_statGroups ) {
         stat.second.finalizeRegistration();
     }
@@ -426,15 +528,46 @@ StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
     H5::DSetCreatPropList cparms;
     hsize_t               chunk_dims[1] = { std::min(m_statGroup->components.size(), (size_t)64) };
     cparms.setChunk(1, chunk_dims);
-    cparms.setDeflate(7);
+    if ( !isCollective() ) cparms.setDeflate(7);
+
+    /* Components on other ranks have no name or coordinates here */
+    size_t                   nComps = m_statGroup->components.size();
+    std::vector<uint64_t>    idVec(m_statGroup->components.begin(), m_statGroup->components.end());
+    std::vector<std::string> nameVec(nComps);
+    std::vector<double>      xVec(nComps, 0.0);
+    std::vector<double>      yVec(nComps, 0.0);
+    std::vector<double>      zVec(nComps, 0.0);
+    size_t                   nameLen = 1;
+
+    for ( size_t i = 0; i < nComps; i++ ) {
+        BaseComponent* comp = m_components.at(i);
+        if ( nullptr == comp ) continue;
+
+        nameVec[i]                        = comp->getName();
+        nameLen                           = std::max(nameLen, nameVec[i].size() + 1);
+        const std::vector<double>& coords = comp->getCoordinates();
+        xVec[i]                           = coords[0];
+        yVec[i]                           = coords[1];
+        zVec[i]                           = coords[2];
+    }
+
+    /* Parallel HDF5 can't write variable length strings */
+#if defined(SST_CONFIG_HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+    if ( isCollective() ) {
+        uint64_t localLen = nameLen;
+        uint64_t maxLen   = 0;
+        MPI_Allreduce(&localLen, &maxLen, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+        nameLen = maxLen;
+    }
+#endif
+    H5::StrType nameType(H5::PredType::C_S1, isCollective() ? nameLen : H5T_VARIABLE);
 
     /* Create arrays */
-    hsize_t       infoDim[1] = { m_statGroup->components.size() };
+    hsize_t       infoDim[1] = { nComps };
     H5::DataSpace infoSpace(1, infoDim);
     H5::DataSet*  idSet =
         new H5::DataSet(getFile()->createDataSet(groupName + "/ids", H5::PredType::NATIVE_UINT64, infoSpace, cparms));
-    H5::DataSet* nameSet   = new H5::DataSet(getFile()->createDataSet(
-        groupName + "/names", H5::StrType(H5::PredType::C_S1, H5T_VARIABLE), infoSpace, cparms));
+    H5::DataSet* nameSet   = new H5::DataSet(getFile()->createDataSet(groupName + "/names", nameType, infoSpace, cparms));
     H5::DataSet* coordXSet = new H5::DataSet(
         getFile()->createDataSet(groupName + "/coord_x", H5::PredType::NATIVE_DOUBLE, infoSpace, cparms));
     H5::DataSet* coordYSet = new H5::DataSet(
@@ -442,28 +575,38 @@ StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
     H5::DataSet* coordZSet = new H5::DataSet(
         getFile()->createDataSet(groupName + "/coord_z", H5::PredType::NATIVE_DOUBLE, infoSpace, cparms));
 
-    std::vector<uint64_t>    idVec;
-    std::vector<const char*> nameVec;
-    std::vector<double>      xVec;
-    std::vector<double>      yVec;
-    std::vector<double>      zVec;
+    if ( isCollective() ) {
+        /* Each rank writes its own components, and rank 0 the ids */
+        const H5::DSetMemXferPropList& xfer = getTransferProps(true);
+        H5::DataSpace                  localSpace(1, infoDim);
+        selectLocalRows(localSpace);
 
-    for ( size_t i = 0; i < infoDim[0]; i++ ) {
-        BaseComponent* comp = m_components.at(i);
+        std::vector<char> fixedNames(nComps * nameLen, '\0');
+        for ( size_t i = 0; i < nComps; i++ ) {
+            memcpy(&fixedNames[i * nameLen], nameVec[i].c_str(), nameVec[i].size());
+        }
 
-        idVec.push_back(comp->getId());
-        nameVec.push_back(comp->getName().c_str());
-        const std::vector<double>& coords = comp->getCoordinates();
-        xVec.push_back(coords[0]);
-        yVec.push_back(coords[1]);
-        zVec.push_back(coords[2]);
+        H5::DataSpace idSpace(1, infoDim);
+        if ( 0 != m_rank ) idSpace.selectNone();
+
+        idSet->write(idVec.data(), H5::PredType::NATIVE_UINT64, idSpace, idSpace, xfer);
+        nameSet->write(fixedNames.data(), nameType, localSpace, localSpace, xfer);
+        coordXSet->write(xVec.data(), H5::PredType::NATIVE_DOUBLE, localSpace, localSpace, xfer);
+        coordYSet->write(yVec.data(), H5::PredType::NATIVE_DOUBLE, localSpace, localSpace, xfer);
+        coordZSet->write(zVec.data(), H5::PredType::NATIVE_DOUBLE, localSpace, localSpace, xfer);
     }
+    else {
+        std::vector<const char*> namePtrs;
+        for ( auto& name : nameVec ) {
+            namePtrs.push_back(name.c_str());
+        }
 
-    idSet->write(idVec.data(), H5::PredType::NATIVE_UINT64);
-    nameSet->write(nameVec.data(), H5::StrType(H5::PredType::C_S1, H5T_VARIABLE));
-    coordXSet->write(xVec.data(), H5::PredType::NATIVE_DOUBLE);
-    coordYSet->write(yVec.data(), H5::PredType::NATIVE_DOUBLE);
-    coordZSet->write(zVec.data(), H5::PredType::NATIVE_DOUBLE);
+        idSet->write(idVec.data(), H5::PredType::NATIVE_UINT64);
+        nameSet->write(namePtrs.data(), nameType);
+        coordXSet->write(xVec.data(), H5::PredType::NATIVE_DOUBLE);
+        coordYSet->write(yVec.data(), H5::PredType::NATIVE_DOUBLE);
+        coordZSet->write(zVec.data(), H5::PredType::NATIVE_DOUBLE);
+    }
 
     delete idSet;
     delete nameSet;
@@ -480,7 +623,79 @@ StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
 }
 
 void
-StatisticOutputHDF5::GroupInfo::startNewGroupEntry()
+StatisticOutputHDF5::GroupInfo::unifyRegistration()
+{
+#if defined(SST_CONFIG_HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+    /* Describe the statistics registered on this rank.  The names start
+     * with the statistic name and subid, followed by the field names. */
+    std::map<std::string, std::vector<std::string>> localNames;
+    std::map<std::string, std::vector<fieldType_t>> localTypes;
+    for ( auto& gs : m_statGroups ) {
+        std::vector<std::string>& names = localNames[gs.first];
+        names.push_back(gs.second.statName);
+        names.push_back(gs.second.statSubId);
+        names.insert(names.end(), gs.second.registeredFields.begin(), gs.second.registeredFields.end());
+        localTypes[gs.first] = gs.second.typeList;
+    }
+
+    std::vector<std::map<std::string, std::vector<std::string>>> allNames;
+    std::vector<std::map<std::string, std::vector<fieldType_t>>> allTypes;
+    Comms::all_gather(localNames, allNames);
+    Comms::all_gather(localTypes, allTypes);
+
+    /* Fields are ordered by the first rank that registered them */
+    std::map<std::string, std::vector<std::string>> fields;
+    std::map<std::string, std::vector<fieldType_t>> types;
+    for ( size_t rank = 0; rank < allNames.size(); rank++ ) {
+        for ( auto& kv : allNames[rank] ) {
+            const std::vector<std::string>& names    = kv.second;
+            const std::vector<fieldType_t>& typeList = allTypes[rank].at(kv.first);
+            if ( m_statGroups.find(kv.first) == m_statGroups.end() ) {
+                m_statGroups.emplace(
+                    std::piecewise_construct, std::forward_as_tuple(kv.first),
+                    std::forward_as_tuple(this, names[0], names[1]));
+            }
+
+            std::vector<std::string>& statFields = fields[kv.first];
+            for ( size_t i = 2; i < names.size(); i++ ) {
+                if ( std::find(statFields.begin(), statFields.end(), names[i]) == statFields.end() ) {
+                    statFields.push_back(names[i]);
+                    types[kv.first].push_back(typeList[i - 2]);
+                }
+            }
+        }
+    }
+
+    for ( auto& gs : m_statGroups ) {
+        const std::vector<std::string>& statFields = fields[gs.first];
+        for ( auto& handle : gs.second.handleIndexMap ) {
+            const std::string& name = gs.second.registeredFields[handle.second];
+            auto               field = std::find(statFields.begin(), statFields.end(), name);
+            handle.second            = std::distance(statFields.begin(), field);
+        }
+        gs.second.registeredFields = statFields;
+        gs.second.typeList         = types[gs.first];
+    }
+#endif
+}
+
+void
+StatisticOutputHDF5::GroupInfo::selectLocalRows(H5::DataSpace& space)
+{
+    hsize_t dims[2] = { 0, 0 };
+    space.getSimpleExtentDims(dims);
+
+    space.selectNone();
+    for ( size_t i = 0; i < m_components.size(); i++ ) {
+        if ( nullptr == m_components[i] ) continue;
+        hsize_t count[2]  = { 1, 1 };
+        hsize_t offset[2] = { i, dims[1] > 0 ? dims[1] - 1 : 0 };
+        space.selectHyperslab(H5S_SELECT_OR, count, offset);
+    }
+}
+
+void
+StatisticOutputHDF5::GroupInfo::startNewGroupEntry(SimTime_t time)
 {
     /* Record current timestamp */
     for ( auto& gs : m_statGroups ) {
@@ -496,12 +711,16 @@ StatisticOutputHDF5::GroupInfo::startNewGroupEntry()
     H5::DataSpace fspace = timeDataSet->getSpace();
     H5::DataSpace memSpace(1, dims);
     fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-    uint64_t currTime = Simulation_impl::getSimulation()->getCurrentSimCycle();
-    timeDataSet->write(&currTime, H5::PredType::NATIVE_UINT64, memSpace, fspace);
+    if ( isCollective() && 0 != m_rank ) {
+        /* Rank 0 writes the time for everyone */
+        fspace.selectNone();
+        memSpace.selectNone();
+    }
+    timeDataSet->write(&time, H5::PredType::NATIVE_UINT64, memSpace, fspace, getTransferProps(isCollective()));
 }
 
 void
-StatisticOutputHDF5::GroupInfo::startNewEntry(StatisticBase* stat)
+StatisticOutputHDF5::GroupInfo::startNewEntry(StatisticBase* stat, SimTime_t UNUSED(time))
 {
     m_currentStat = &(m_statGroups.at(GroupStat::getStatName(stat)));
     size_t compIndex =
@@ -537,27 +756,41 @@ StatisticOutputHDF5::GroupInfo::GroupStat::getStatName(StatisticBase* stat)
     return stat->getStatName() + "." + stat->getStatSubId();
 }
 
-StatisticOutputHDF5::GroupInfo::GroupStat::GroupStat(GroupInfo* group, StatisticBase* stat) : gi(group), nEntries(0)
+StatisticOutputHDF5::GroupInfo::GroupStat::GroupStat(
+    GroupInfo* group, const std::string& statName, const std::string& statSubId) :
+    gi(group),
+    statName(statName),
+    statSubId(statSubId),
+    dataset(nullptr),
+    memType(nullptr),
+    nEntries(0)
 {
+    statPath = "/" + group->getName() + "/" + statName;
+    if ( statSubId.length() > 0 ) statPath += "/" + statSubId;
+}
 
-    /* Create the file hierarchy */
-    statPath = "/" + group->getName() + "/" + stat->getStatName();
-    if ( stat->getStatSubId().length() > 0 ) {
+StatisticOutputHDF5::GroupInfo::GroupStat::~GroupStat()
+{
+    if ( dataset ) delete dataset;
+    if ( memType ) delete memType;
+}
+
+void
+StatisticOutputHDF5::GroupInfo::GroupStat::finalizeRegistration()
+{
+    /* Create the file hierarchy.  This happens here rather than as the
+     * statistics register, so every rank does it in the same order. */
+    if ( statSubId.length() > 0 ) {
         try {
-            H5::Group* statGroup = new H5::Group(group->getFile()->createGroup(statPath));
+            H5::Group* statGroup = new H5::Group(gi->getFile()->createGroup("/" + gi->getName() + "/" + statName));
             statGroup->close();
             delete statGroup;
         }
         catch ( H5::FileIException ie ) {
             /* Ignore - group already exists. */
         }
-        statPath += "/" + stat->getStatSubId();
     }
-}
 
-void
-StatisticOutputHDF5::GroupInfo::GroupStat::finalizeRegistration()
-{
     size_t nslots = registeredFields.size();
     currentData.resize(nslots * gi->getNumComponents());
 
@@ -577,7 +810,8 @@ StatisticOutputHDF5::GroupInfo::GroupStat::finalizeRegistration()
     H5::DSetCreatPropList cparms;
     hsize_t               chunk_dims[2] = { std::min((hsize_t)16, dims[0]), 128 };
     cparms.setChunk(2, chunk_dims);
-    cparms.setDeflate(7);
+    /* Filters need collective writes from a recent parallel HDF5 */
+    if ( !gi->isCollective() ) cparms.setDeflate(7);
 
     dataset = new H5::DataSet(gi->getFile()->createDataSet(statPath, *memType, dspace, cparms));
 }
@@ -619,8 +853,15 @@ StatisticOutputHDF5::GroupInfo::GroupStat::finishGroupEntry()
 
     H5::DataSpace fspace = dataset->getSpace();
     H5::DataSpace memSpace(2, dims);
-    fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-    dataset->write(currentData.data(), *memType, memSpace, fspace);
+    if ( gi->isCollective() ) {
+        /* Each rank writes the rows of its own components */
+        gi->selectLocalRows(fspace);
+        gi->selectLocalRows(memSpace);
+    }
+    else {
+        fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
+    }
+    dataset->write(currentData.data(), *memType, memSpace, fspace, getTransferProps(gi->isCollective()));
 }
 
 } // namespace Statistics
@@ -29,7 +29,14 @@ namespace Statistics {
 /**
     \class StatisticOutputHDF5
 
-    The class for statistics output to a comma separated file.
+    The class for statistics output to a HDF5 file.
+
+    Each rank normally writes its own file, with the rank added to the
+    file name.  With collective set and an HDF5 library built with
+    parallel support, all ranks share one file instead: the datasets of
+    a statistic group have a row for every component in the group, and
+    each rank writes the rows of its own components for every output.
+    Only statistic groups can be written in that mode.
 */
 class StatisticOutputHDF5 : public StatisticFieldsOutput
 {
@@ -122,9 +129,10 @@ private:
     class DataSet
     {
     public:
-        DataSet(H5::H5File* file) : file(file) {}
+        DataSet(H5::H5File* file, bool collective = false) : file(file), collective(collective) {}
         virtual ~DataSet() {}
         H5::H5File*  getFile() { return file; }
+        bool         isCollective() const { return collective; }
         virtual bool isGroup() const = 0;
 
         virtual void setCurrentStatistic(StatisticBase* UNUSED(stat)) {}
@@ -134,15 +142,17 @@ private:
         virtual void beginGroupRegistration(StatisticGroup* UNUSED(group)) {}
         virtual void finalizeGroupRegistration() {}
 
-        virtual void startNewGroupEntry() {}
+        virtual void startNewGroupEntry(SimTime_t UNUSED(time)) {}
         virtual void finishGroupEntry() {}
 
-        virtual void        startNewEntry(StatisticBase* stat)     = 0;
-        virtual StatData_u& getFieldLoc(fieldHandle_t fieldHandle) = 0;
-        virtual void        finishEntry()                          = 0;
+        virtual void        startNewEntry(StatisticBase* stat, SimTime_t time) = 0;
+        virtual StatData_u& getFieldLoc(fieldHandle_t fieldHandle)             = 0;
+        virtual void        finishEntry()                                      = 0;
 
     protected:
         H5::H5File* file;
+        /** All ranks write to file, so every file operation is collective */
+        bool        collective;
     };
 
     class StatisticInfo : public DataSet
@@ -174,7 +184,7 @@ private:
         void finalizeCurrentStatistic() override;
 
         bool        isGroup() const override { return false; }
-        void        startNewEntry(StatisticBase* stat) override;
+        void        startNewEntry(StatisticBase* stat, SimTime_t time) override;
         StatData_u& getFieldLoc(fieldHandle_t fieldHandle) override;
         void        finishEntry() override;
     };
@@ -184,6 +194,8 @@ private:
         struct GroupStat
         {
             GroupInfo*  gi;
+            std::string statName;
+            std::string statSubId;
             std::string statPath;
 
             H5::DataSet*  dataset;
@@ -198,7 +210,8 @@ private:
             std::vector<StatData_u> currentData;
             size_t                  currentCompOffset;
 
-            GroupStat(GroupInfo* group, StatisticBase* stat);
+            GroupStat(GroupInfo* group, const std::string& statName, const std::string& statSubId);
+            ~GroupStat();
             void               finalizeRegistration();
             static std::string getStatName(StatisticBase* stat);
 
@@ -211,15 +224,27 @@ private:
             void finishGroupEntry();
         };
 
+        /** Make every rank register the same statistics and fields, so
+         * the collective file operations match up across ranks */
+        void unifyRegistration();
+
+        /** Select the rows of the components on this rank, in the last
+         * column for a 2-D space */
+        void selectLocalRows(H5::DataSpace& space);
+
         hsize_t                          nEntries;
         std::map<std::string, GroupStat> m_statGroups;
         GroupStat*                       m_currentStat;
         StatisticGroup*                  m_statGroup;
         std::vector<BaseComponent*>      m_components;
         H5::DataSet*                     timeDataSet;
+        // Group entries can be written on the async output thread,
+        // which can't look up the Simulation, so the rank is kept here
+        int                              m_rank;
 
     public:
-        GroupInfo(StatisticGroup* group, H5::H5File* file);
+        GroupInfo(StatisticGroup* group, H5::H5File* file, bool collective, int rank);
+        ~GroupInfo();
         void beginGroupRegistration(StatisticGroup* UNUSED(group)) override {}
         void setCurrentStatistic(StatisticBase* stat) override;
         void registerField(StatisticFieldInfo* fi) override;
@@ -227,11 +252,11 @@ private:
         void finalizeGroupRegistration() override;
 
         bool        isGroup() const override { return true; }
-        void        startNewEntry(StatisticBase* stat) override;
+        void        startNewEntry(StatisticBase* stat, SimTime_t time) override;
         StatData_u& getFieldLoc(fieldHandle_t fieldHandle) override { return m_currentStat->getFieldLoc(fieldHandle); }
         void        finishEntry() override;
 
-        void   startNewGroupEntry() override;
+        void   startNewGroupEntry(SimTime_t time) override;
         void   finishGroupEntry() override;
         size_t getNumComponents() const { return m_components.size(); }
 
@@ -239,6 +264,8 @@ private:
     };
 
     H5::H5File*                              m_hFile;
+    bool                                     m_collective;
+    int                                      m_rank;
     DataSet*                                 m_currentDataSet;
     std::map<StatisticBase*, StatisticInfo*> m_statistics;
     std::map<std::string, GroupInfo>         m_statGroups;
@@ -0,0 +1,346 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATQUANTILESKETCH_H
+#define SST_CORE_STATAPI_STATQUANTILESKETCH_H
+
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class QuantileSketchStatistic
+
+    Estimates percentiles of the values presented to it without keeping
+    the values or knowing their range up front.  Values are counted in
+    logarithmically sized buckets (a DDSketch), so every percentile is
+    reported within the configured relative accuracy of a value that was
+    actually presented.  Memory is bounded by maxbins buckets each for
+    positive and negative values; when a range grows past that, the
+    buckets closest to zero are collapsed.
+
+    @tparam NumberBase A template for the basic numerical type of values
+*/
+template <typename NumberBase>
+class QuantileSketchStatistic : public Statistic<NumberBase>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        QuantileSketchStatistic,
+        "sst",
+        "QuantileSketchStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Estimate percentiles of a statistic to a relative accuracy in bounded memory",
+        "SST::Statistic<T>")
+
+    QuantileSketchStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<NumberBase>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("accuracy");
+        allowedKeySet.insert("maxbins");
+        allowedKeySet.insert("percentiles");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // Process the Parameters
+        double accuracy = statParams.find<double>("accuracy", 0.01);
+        m_maxBins       = statParams.find<uint32_t>("maxbins", 2048);
+        statParams.find_array<double>("percentiles", m_percentiles);
+        if ( m_percentiles.empty() ) m_percentiles = { 50, 90, 99, 99.9 };
+
+        if ( accuracy <= 0 || accuracy >= 1 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Statistic %s accuracy must be between 0 and 1, got %f\n",
+                this->getFullStatName().c_str(), accuracy);
+        }
+        for ( double percentile : m_percentiles ) {
+            if ( percentile < 0 || percentile > 100 ) {
+                Output::getDefaultObject().fatal(
+                    CALL_INFO, 1, "ERROR: Statistic %s percentiles must be between 0 and 100, got %f\n",
+                    this->getFullStatName().c_str(), percentile);
+            }
+        }
+        if ( 0 == m_maxBins ) m_maxBins = 1;
+
+        m_gamma    = (1.0 + accuracy) / (1.0 - accuracy);
+        m_logGamma = std::log(m_gamma);
+
+        clearStatisticData();
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("QuantileSketch");
+    }
+
+    ~QuantileSketchStatistic() {}
+
+protected:
+    /**
+        Present a new value to the class to be included in the sketch.
+        @param value New value to be presented
+    */
+    void addData_impl(NumberBase value) override { addData_impl_Ntimes(1, value); }
+
+    void addData_impl_Ntimes(uint64_t N, NumberBase value) override
+    {
+        m_sum += N * value;
+        m_min = (value < m_min) ? value : m_min;
+        m_max = (value > m_max) ? value : m_max;
+        m_count += N;
+
+        double v = static_cast<double>(value);
+        if ( v > 0 )
+            m_positive.add(getIndex(v), N, m_maxBins);
+        else if ( v < 0 )
+            m_negative.add(getIndex(-v), N, m_maxBins);
+        else
+            m_zeroCount += N;
+    }
+
+public:
+    /**
+        Estimate a percentile of the values presented so far.
+        @param percentile Percentile to estimate, from 0 to 100
+        @return The estimate, or 0 if no values were presented
+    */
+    double getPercentile(double percentile)
+    {
+        if ( 0 == m_count ) return 0;
+
+        double   rank = percentile / 100.0 * (m_count - 1);
+        uint64_t seen = 0;
+
+        // The most negative values have the highest index
+        for ( size_t i = m_negative.counts.size(); i-- > 0; ) {
+            seen += m_negative.counts[i];
+            if ( seen > rank ) return clampValue(-getValue(m_negative.offset + i));
+        }
+        seen += m_zeroCount;
+        if ( seen > rank ) return clampValue(0);
+        for ( size_t i = 0; i < m_positive.counts.size(); i++ ) {
+            seen += m_positive.counts[i];
+            if ( seen > rank ) return clampValue(getValue(m_positive.offset + i));
+        }
+        return static_cast<double>(m_max);
+    }
+
+    /**
+        Get a count of the number of elements presented to the statistics collection so far.
+        @return Count the number of values presented to the class.
+    */
+    uint64_t getCount() { return this->getCollectionCount(); }
+
+    void clearStatisticData() override
+    {
+        m_sum       = 0;
+        m_min       = std::numeric_limits<NumberBase>::max();
+        m_max       = std::numeric_limits<NumberBase>::lowest();
+        m_count     = 0;
+        m_zeroCount = 0;
+        m_positive.clear();
+        m_negative.clear();
+        this->setCollectionCount(0);
+    }
+
+    StatisticBase* createMergeTarget() override
+    {
+        Params params = this->getParams();
+        return new QuantileSketchStatistic<NumberBase>(
+            this->getComponent(), this->getStatName(), this->getStatSubId(), params);
+    }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        // Statistics are only merged if getMergeParams() matches, so
+        // the bucket indices line up
+        QuantileSketchStatistic<NumberBase>* stat = static_cast<QuantileSketchStatistic<NumberBase>*>(other);
+        if ( 0 != stat->m_count ) {
+            m_min = (stat->m_min < m_min) ? stat->m_min : m_min;
+            m_max = (stat->m_max > m_max) ? stat->m_max : m_max;
+        }
+        m_sum += stat->m_sum;
+        m_count += stat->m_count;
+        m_zeroCount += stat->m_zeroCount;
+        m_positive.merge(stat->m_positive, m_maxBins);
+        m_negative.merge(stat->m_negative, m_maxBins);
+        this->setCollectionCount(getCount() + stat->getCount());
+    }
+
+    std::string getMergeParams() const override
+    {
+        std::stringstream params;
+        params.precision(17);
+        params << "gamma=" << m_gamma;
+        return params.str();
+    }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_sum;
+        ser& m_min;
+        ser& m_max;
+        ser& m_count;
+        ser& m_zeroCount;
+        ser& m_positive.offset;
+        ser& m_positive.counts;
+        ser& m_negative.offset;
+        ser& m_negative.counts;
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        h_count = statOutput->registerField<uint64_t>("Count");
+        h_sum   = statOutput->registerField<NumberBase>("Sum");
+        h_min   = statOutput->registerField<NumberBase>("Min");
+        h_max   = statOutput->registerField<NumberBase>("Max");
+
+        // Field names can't contain '.', so 99.9 becomes P99_9
+        for ( double percentile : m_percentiles ) {
+            std::stringstream ss;
+            ss << "P" << percentile;
+            std::string name = ss.str();
+            std::replace(name.begin(), name.end(), '.', '_');
+            h_percentiles.push_back(statOutput->registerField<double>(name.c_str()));
+        }
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        statOutput->outputField(h_count, getCount());
+        statOutput->outputField(h_sum, m_sum);
+
+        if ( 0 == m_count ) {
+            statOutput->outputField(h_min, 0);
+            statOutput->outputField(h_max, 0);
+        }
+        else {
+            statOutput->outputField(h_min, m_min);
+            statOutput->outputField(h_max, m_max);
+        }
+
+        for ( size_t i = 0; i < m_percentiles.size(); i++ ) {
+            statOutput->outputField(h_percentiles[i], getPercentile(m_percentiles[i]));
+        }
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        switch ( mode ) {
+        case StatisticBase::STAT_MODE_COUNT:
+        case StatisticBase::STAT_MODE_PERIODIC:
+        case StatisticBase::STAT_MODE_DUMP_AT_END:
+            return true;
+        default:
+            return false;
+        }
+        return false;
+    }
+
+private:
+    /** Counts for a contiguous range of bucket indices */
+    struct Store
+    {
+        int32_t               offset = 0; /*!< Bucket index of counts[0] */
+        std::vector<uint64_t> counts;
+
+        void clear()
+        {
+            offset = 0;
+            counts.clear();
+        }
+
+        void add(int32_t index, uint64_t count, size_t maxBins)
+        {
+            if ( counts.empty() ) {
+                offset = index;
+                counts.push_back(0);
+            }
+            int64_t top = offset + (int64_t)counts.size() - 1;
+            if ( index < offset ) { grow(std::max<int64_t>(index, top - (int64_t)maxBins + 1), top); }
+            else if ( index > top ) {
+                grow(std::max<int64_t>(offset, (int64_t)index - (int64_t)maxBins + 1), index);
+            }
+
+            // Values below a collapsed range count in its lowest bucket
+            if ( index < offset ) index = offset;
+            counts[index - offset] += count;
+        }
+
+        void merge(const Store& other, size_t maxBins)
+        {
+            for ( size_t i = 0; i < other.counts.size(); i++ ) {
+                if ( 0 != other.counts[i] ) add(other.offset + i, other.counts[i], maxBins);
+            }
+        }
+
+    private:
+        /** Cover indices [low, top].  Buckets below low are collapsed
+         * into it, which only loses accuracy closest to zero. */
+        void grow(int64_t low, int64_t top)
+        {
+            std::vector<uint64_t> grown(top - low + 1, 0);
+            for ( size_t i = 0; i < counts.size(); i++ ) {
+                grown[std::max<int64_t>(offset + i, low) - low] += counts[i];
+            }
+            counts.swap(grown);
+            offset = low;
+        }
+    };
+
+    /** Bucket holding a positive value: (gamma^(index-1), gamma^index] */
+    int32_t getIndex(double value) const { return static_cast<int32_t>(std::ceil(std::log(value) / m_logGamma)); }
+
+    /** Value reported for a bucket, within the relative accuracy of all
+     * the values in it */
+    double getValue(int64_t index) const { return 2.0 * std::pow(m_gamma, (double)index) / (m_gamma + 1.0); }
+
+    /** The bucket estimate can fall just outside the values presented */
+    double clampValue(double value) const
+    {
+        return std::min(std::max(value, static_cast<double>(m_min)), static_cast<double>(m_max));
+    }
+
+    double              m_gamma;
+    double              m_logGamma;
+    uint32_t            m_maxBins;
+    std::vector<double> m_percentiles;
+
+    NumberBase m_sum;
+    NumberBase m_min;
+    NumberBase m_max;
+    uint64_t   m_count;
+    uint64_t   m_zeroCount;
+    Store      m_positive;
+    Store      m_negative;
+
+    StatisticOutput::fieldHandle_t              h_count;
+    StatisticOutput::fieldHandle_t              h_sum;
+    StatisticOutput::fieldHandle_t              h_min;
+    StatisticOutput::fieldHandle_t              h_max;
+    std::vector<StatisticOutput::fieldHandle_t> h_percentiles;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATQUANTILESKETCH_H
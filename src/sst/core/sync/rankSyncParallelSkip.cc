@@ -52,7 +52,6 @@ SimTime_t RankSyncParallelSkip::myNextSyncTime = 0;
 RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
     RankSync(num_ranks),
     mpiWaitTime(0.0),
-    deserializeTime(0.0),
     send_count(0),
     serializeReadyBarrier(num_ranks.thread),
     slaveExchangeDoneBarrier(num_ranks.thread),
@@ -61,16 +60,20 @@ RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UN
     // TraceFunction(CALL_INFO_LONG);
     max_period     = Simulation_impl::getSimulation()->getMinPartTC();
     myNextSyncTime = max_period->getFactor();
-    recv_count     = new int[num_ranks.thread];
+    recv_count      = new int[num_ranks.thread];
+    deserializeTime = new double[num_ranks.thread];
     for ( uint32_t i = 0; i < num_ranks.thread; i++ ) {
-        recv_count[i] = 0;
+        recv_count[i]      = 0;
+        deserializeTime[i] = 0.0;
     }
     link_send_queue = new SST::Core::ThreadSafe::UnboundedQueue<comm_recv_pair*>[num_ranks.thread];
 }
 
 RankSyncParallelSkip::~RankSyncParallelSkip()
 {
+    SyncQueue::CompressionStats compression;
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
+        compression.add(i->second.squeue->getCompressionStats());
         delete i->second.squeue;
     }
     comm_send_map.clear();
@@ -80,13 +83,30 @@ RankSyncParallelSkip::~RankSyncParallelSkip()
     }
     comm_recv_map.clear();
 
+    // Deserialization is done in parallel, so also report the thread
+    // that spent the most time in it
+    double totalDeserializeTime = 0.0;
+    double maxDeserializeTime   = 0.0;
+    for ( uint32_t i = 0; i < num_ranks.thread; i++ ) {
+        totalDeserializeTime += deserializeTime[i];
+        if ( deserializeTime[i] > maxDeserializeTime ) maxDeserializeTime = deserializeTime[i];
+    }
+
     delete[] recv_count;
+    delete[] deserializeTime;
     delete[] link_send_queue;
 
-    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
+    if ( mpiWaitTime > 0.0 || totalDeserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0,
+            "RankSyncParallelSkip mpiWait: %lg sec  deserializeWait:  %lg sec (max per thread: %lg sec)\n",
+            mpiWaitTime, totalDeserializeTime, maxDeserializeTime);
+    if ( compression.raw_bytes > 0 )
         Output::getDefaultObject().verbose(
-            CALL_INFO, 1, 0, "RankSyncParallelSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime,
-            deserializeTime);
+            CALL_INFO, 1, 0,
+            "RankSyncParallelSkip compression: %" PRIu64 " -> %" PRIu64 " bytes (ratio %.2f)  compressTime: %lg sec\n",
+            compression.raw_bytes, compression.compressed_bytes,
+            (double)compression.raw_bytes / compression.compressed_bytes, compression.time);
 }
 
 ActivityQueue*
@@ -118,6 +138,7 @@ RankSyncParallelSkip::registerLink(
     }
 
     link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+    recordSendLatency(link);
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     link->setSendingComponentInfo("SYNC", "SYNC", "");
 #endif
@@ -129,7 +150,6 @@ RankSyncParallelSkip::finalizeLinkConfigurations()
 {
     // Set the size of the BoundedQueue that is the work queue for
     // serializations
-    deserialize_queue.initialize(comm_recv_map.size());
     serialize_queue.initialize(comm_send_map.size());
     send_queue.initialize(comm_send_map.size());
 }
@@ -197,16 +217,16 @@ RankSyncParallelSkip::exchange_slave(int thread)
     // links
     SimTime_t current_cycle = sim->getCurrentSimCycle();
 
-    // Two things left to do.  Deserialize receives and send
-    // deserialized events on the proper link.  Will preferentially
-    // send first.
+    // Receive buffers are split by the local thread their links
+    // belong to, so each thread deserializes and delivers the events
+    // for its own links as soon as their buffers arrive.  This also
+    // keeps the events in the memory pools of the thread that will
+    // delete them.
     comm_recv_pair* recv;
-    while ( my_recv_count != 0 || remaining_deser.load() != 0 ) {
-        // Check to see if there are sends to be done.
+    while ( my_recv_count != 0 ) {
         if ( link_send_queue[thread].try_remove(recv) ) {
-
-            // comm_recv_pair* recv = link_send_queue[thread].remove();
             my_recv_count--;
+            deserializeMessage(recv, thread);
 
             for ( size_t i = 0; i < recv->activity_vec.size(); i++ ) {
                 Event*    ev    = static_cast<Event*>(recv->activity_vec[i]);
@@ -215,10 +235,8 @@ RankSyncParallelSkip::exchange_slave(int thread)
             }
             recv->activity_vec.clear();
         }
-        else if ( deserialize_queue.try_remove(recv) ) {
-            remaining_deser--;
-            deserializeMessage(recv);
-            link_send_queue[recv->local_thread].insert(recv);
+        else {
+            sst_pause();
         }
     }
     slaveExchangeDoneBarrier.wait();
@@ -239,8 +257,6 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
         serialize_queue.try_insert(&(i->second));
     }
 
-    remaining_deser = comm_recv_map.size();
-
     serializeReadyBarrier.wait(); /* Wait for / release slaves to serialize */
 
     for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
@@ -330,7 +346,7 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
                         buffer = i->second.rbuf;
                     }
 
-                    deserialize_queue.try_insert(&(i->second));
+                    link_send_queue[i->second.local_thread].insert(&(i->second));
                 }
             }
         }
@@ -348,17 +364,10 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
         i->second.squeue->clear();
     }
 
-    // Check to see when the next event is scheduled, then do an
-    // all_reduce with min operator and set next sync time to be
-    // min + max_period.
-
-    // Need to get the local minimum, then do a global minimum
-    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
-
-    myNextSyncTime = min_time + max_period->getFactor();
+    // Compute the next sync time.  This is the global minimum next
+    // activity time plus either the minimum partition latency or, with
+    // adaptive lookahead, the latency of each rank's own cut links.
+    myNextSyncTime = computeNextSyncTime();
 
 #endif
 }
@@ -435,11 +444,8 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        ser&                   activities;
+        SyncQueue::unpackData(buffer, activities);
 
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
@@ -465,20 +471,13 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 }
 
 void
-RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
+RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg, int thread)
 {
-    char*              buffer = msg->rbuf;
-    SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
-    unsigned int       size   = hdr->buffer_size;
-
     auto deserialStart = SST::Core::Profile::now();
 
-    SST::Core::Serialization::serializer ser;
-
-    ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
-    ser & msg->activity_vec;
+    SyncQueue::unpackData(msg->rbuf, msg->activity_vec);
 
-    deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+    deserializeTime[thread] += SST::Core::Profile::getElapsed(deserialStart);
 }
 
 } // namespace SST
@@ -91,19 +91,17 @@ private:
     comm_recv_map_t comm_recv_map;
     link_map_t      link_map;
 
-    double mpiWaitTime;
-    double deserializeTime;
+    double  mpiWaitTime;
+    double* deserializeTime; // Indexed by thread
 
     int* recv_count;
     int  send_count;
 
-    std::atomic<int32_t>                                    remaining_deser;
-    SST::Core::ThreadSafe::BoundedQueue<comm_recv_pair*>    deserialize_queue;
     SST::Core::ThreadSafe::UnboundedQueue<comm_recv_pair*>* link_send_queue;
     SST::Core::ThreadSafe::BoundedQueue<comm_send_pair*>    serialize_queue;
     SST::Core::ThreadSafe::BoundedQueue<comm_send_pair*>    send_queue;
 
-    void deserializeMessage(comm_recv_pair* msg);
+    void deserializeMessage(comm_recv_pair* msg, int thread);
 
     Core::ThreadSafe::Barrier serializeReadyBarrier;
     Core::ThreadSafe::Barrier slaveExchangeDoneBarrier;
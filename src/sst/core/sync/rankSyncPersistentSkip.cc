@@ -0,0 +1,421 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncPersistentSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <cstring>
+
+#ifdef SST_CONFIG_HAVE_MPI
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+#if SST_EVENT_PROFILING
+#define SST_EVENT_PROFILE_START auto event_profile_start = std::chrono::high_resolution_clock::now();
+
+#define SST_EVENT_PROFILE_STOP                                                                                  \
+    auto event_profile_stop = std::chrono::high_resolution_clock::now();                                        \
+    auto event_profile_count =                                                                                  \
+        std::chrono::duration_cast<std::chrono::nanoseconds>(event_profile_stop - event_profile_start).count(); \
+    sim->incrementSerialCounters(event_profile_count);
+#else
+#define SST_EVENT_PROFILE_START
+#define SST_EVENT_PROFILE_STOP
+#endif
+
+// Tags 1 and 2 are used by the untimed data exchange
+#define SLOT_TAG     3
+#define OVERFLOW_TAG 4
+
+namespace SST {
+
+// Static Data Members
+SimTime_t      RankSyncPersistentSkip::myNextSyncTime = 0;
+const uint32_t RankSyncPersistentSkip::max_slot_size;
+const uint32_t RankSyncPersistentSkip::min_slot_size;
+
+RankSyncPersistentSkip::RankSyncPersistentSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+    RankSync(num_ranks)
+{
+    max_period     = Simulation_impl::getSimulation()->getMinPartTC();
+    myNextSyncTime = max_period->getFactor();
+}
+
+RankSyncPersistentSkip::~RankSyncPersistentSkip()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.mpiWaitTime > 0.0 || i->second.deserializeTime > 0.0 )
+            Output::getDefaultObject().verbose(
+                CALL_INFO, 1, 0, "RankSyncPersistentSkip peer %d mpiWait: %lg sec  deserializeWait:  %lg sec\n",
+                i->first, i->second.mpiWaitTime, i->second.deserializeTime);
+        const SyncQueue::CompressionStats& compression = i->second.squeue->getCompressionStats();
+        if ( compression.raw_bytes > 0 )
+            Output::getDefaultObject().verbose(
+                CALL_INFO, 1, 0,
+                "RankSyncPersistentSkip peer %d compression: %" PRIu64 " -> %" PRIu64
+                " bytes (ratio %.2f)  compressTime: %lg sec\n",
+                i->first, compression.raw_bytes, compression.compressed_bytes,
+                (double)compression.raw_bytes / compression.compressed_bytes, compression.time);
+        delete i->second.squeue;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+}
+
+ActivityQueue*
+RankSyncPersistentSkip::registerLink(
+    const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), const std::string& name, Link* link)
+{
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        // Everything else is value initialized to zero
+        comm_pair& pair     = comm_map[to_rank.rank];
+        queue = pair.squeue = new SyncQueue();
+        pair.rbuf           = new char[4096];
+        pair.local_size     = 4096;
+        pair.remote_size    = 4096;
+        pair.send_slot_size = min_slot_size;
+        pair.recv_slot_size = min_slot_size;
+    }
+    else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+    recordSendLatency(link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncPersistentSkip::finalizeLinkConfigurations()
+{}
+
+void
+RankSyncPersistentSkip::prepareForComplete()
+{
+    // Persistent requests are only used during run
+    freeRequests();
+}
+
+uint64_t
+RankSyncPersistentSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.local_size);
+    }
+    return count;
+}
+
+void
+RankSyncPersistentSkip::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+uint32_t
+RankSyncPersistentSkip::nextSlotSize(uint32_t slot_size, uint32_t& high_water, uint32_t data_size)
+{
+    // The high water mark decays by 1/16 each window, so a single large
+    // window only keeps the slot big for a few dozen windows
+    high_water -= high_water / 16;
+    if ( data_size > high_water ) high_water = data_size;
+
+    while ( slot_size < data_size && slot_size < max_slot_size ) {
+        slot_size *= 2;
+    }
+    if ( slot_size > max_slot_size ) slot_size = max_slot_size;
+
+    // Only shrink once the slot is four times what has recently been
+    // needed so the size doesn't bounce back and forth
+    while ( slot_size > min_slot_size && high_water <= slot_size / 4 ) {
+        slot_size /= 2;
+    }
+    return slot_size;
+}
+
+void
+RankSyncPersistentSkip::waitForSend(comm_pair& UNUSED_WO_MPI(pair), send_buffer& UNUSED_WO_MPI(sbuf))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !sbuf.active ) return;
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Wait(&sbuf.req, MPI_STATUS_IGNORE);
+    if ( sbuf.overflow ) MPI_Wait(&sbuf.overflow_req, MPI_STATUS_IGNORE);
+    pair.mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    sbuf.active = false;
+#endif
+}
+
+void
+RankSyncPersistentSkip::freeRequests()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        comm_pair& pair = i->second;
+        for ( auto& sbuf : pair.sbufs ) {
+            waitForSend(pair, sbuf);
+            if ( sbuf.buf != nullptr ) {
+                MPI_Request_free(&sbuf.req);
+                sbuf.buf = nullptr;
+            }
+        }
+        if ( pair.recv_init ) {
+            MPI_Request_free(&pair.recv_req);
+            pair.recv_init = false;
+        }
+    }
+#endif
+}
+
+void
+RankSyncPersistentSkip::exchange(void)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    // Start all the receives before doing any of the sends
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        comm_pair& pair = i->second;
+        if ( !pair.recv_init ) {
+            MPI_Recv_init(
+                pair.rbuf, pair.recv_slot_size, MPI_BYTE, i->first, SLOT_TAG, MPI_COMM_WORLD, &pair.recv_req);
+            pair.recv_init = true;
+        }
+        MPI_Start(&pair.recv_req);
+    }
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        comm_pair&   pair = i->second;
+        send_buffer& sbuf = pair.sbufs[pair.current];
+
+        // This buffer was last sent two sync windows ago, so the send
+        // has most likely already completed
+        waitForSend(pair, sbuf);
+
+        SST_EVENT_PROFILE_START
+
+        // The whole slot gets sent, so the buffer needs to be at least
+        // that big
+        pair.squeue->reserveBuffer(pair.send_slot_size);
+        char* send_buffer = pair.squeue->getData();
+
+        SST_EVENT_PROFILE_STOP
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        uint32_t           size = hdr->buffer_size;
+        hdr->mode               = 0;
+
+        // Persistent requests are tied to a buffer and size, so need
+        // a new one if either changed
+        if ( sbuf.buf != send_buffer || sbuf.slot_size != pair.send_slot_size ) {
+            if ( sbuf.buf != nullptr ) MPI_Request_free(&sbuf.req);
+            MPI_Send_init(
+                send_buffer, pair.send_slot_size, MPI_BYTE, i->first /*dest*/, SLOT_TAG, MPI_COMM_WORLD, &sbuf.req);
+            sbuf.buf       = send_buffer;
+            sbuf.slot_size = pair.send_slot_size;
+        }
+        MPI_Start(&sbuf.req);
+
+        // Anything that doesn't fit in the slot goes right behind it
+        sbuf.overflow = size > pair.send_slot_size;
+        if ( sbuf.overflow ) {
+            MPI_Isend(
+                send_buffer + pair.send_slot_size, size - pair.send_slot_size, MPI_BYTE, i->first /*dest*/,
+                OVERFLOW_TAG, MPI_COMM_WORLD, &sbuf.overflow_req);
+        }
+        sbuf.active = true;
+
+        pair.send_slot_size = nextSlotSize(pair.send_slot_size, pair.send_high_water, size);
+        pair.squeue->swapBuffers();
+        pair.current ^= 1;
+    }
+
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+
+    // Wait for the slots to arrive and post the receives for anything
+    // that didn't fit before deserializing anything
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        comm_pair& pair = i->second;
+
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Wait(&pair.recv_req, MPI_STATUS_IGNORE);
+        pair.mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+        uint32_t size      = reinterpret_cast<SyncQueue::Header*>(pair.rbuf)->buffer_size;
+        uint32_t next_slot = nextSlotSize(pair.recv_slot_size, pair.recv_high_water, size);
+
+        pair.overflow = size > pair.recv_slot_size;
+        if ( pair.overflow ) {
+            uint32_t needed = size > next_slot ? size : next_slot;
+            if ( needed > pair.local_size ) {
+                // Keep the part of the data that has already arrived
+                char* buf = new char[needed];
+                std::memcpy(buf, pair.rbuf, pair.recv_slot_size);
+                delete[] pair.rbuf;
+                pair.rbuf       = buf;
+                pair.local_size = needed;
+                MPI_Request_free(&pair.recv_req);
+                pair.recv_init = false;
+            }
+            MPI_Irecv(
+                pair.rbuf + pair.recv_slot_size, size - pair.recv_slot_size, MPI_BYTE, i->first, OVERFLOW_TAG,
+                MPI_COMM_WORLD, &pair.overflow_req);
+        }
+
+        if ( next_slot != pair.recv_slot_size ) {
+            if ( pair.recv_init ) MPI_Request_free(&pair.recv_req);
+            pair.recv_init      = false;
+            pair.recv_slot_size = next_slot;
+        }
+    }
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        comm_pair& pair = i->second;
+
+        if ( pair.overflow ) {
+            auto waitStart = SST::Core::Profile::now();
+            MPI_Wait(&pair.overflow_req, MPI_STATUS_IGNORE);
+            pair.mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        }
+
+        // Get the buffer and deserialize all the events
+        char* buffer = pair.rbuf;
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        std::vector<Activity*> activities;
+        SyncQueue::unpackData(buffer, activities);
+
+        pair.deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event*    ev    = static_cast<Event*>(activities[j]);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+        }
+    }
+
+    // Compute the next sync time.  This is the global minimum next
+    // activity time plus either the minimum partition latency or, with
+    // adaptive lookahead, the latency of each rank's own cut links.
+    myNextSyncTime = computeNextSyncTime();
+#endif
+}
+
+void
+RankSyncPersistentSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( thread != 0 ) { return; }
+    // Maximum number of outstanding requests is 3 times the number of
+    // ranks I communicate with (1 recv, 2 sends per rank)
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         rreq_count = 0;
+    int         sreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char*              send_buffer = i->second.squeue->getData();
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag         = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    // Wait for all recvs to complete
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            buffer = i->second.rbuf;
+        }
+
+        std::vector<Activity*> activities;
+        SyncQueue::unpackData(buffer, activities);
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
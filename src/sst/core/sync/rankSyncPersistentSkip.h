@@ -0,0 +1,134 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCPERSISTENTSKIP_H
+#define SST_CORE_SYNC_RANKSYNCPERSISTENTSKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * Rank sync for one thread per rank that uses persistent MPI requests.
+ *
+ * Each peer gets a fixed size message slot in each direction.  The
+ * first slot_size bytes of the serialized events are always sent with a
+ * persistent request.  Anything past that is sent right away as a
+ * second message, so the receiver never needs an extra round trip to
+ * learn the size.  Both sides grow the slot size the same way based on
+ * the size in the header, and shrink it again once a decaying high
+ * water mark of those sizes drops well below the slot, so no other
+ * negotiation is needed.
+ *
+ * The SyncQueues are double buffered.  The sends from a sync window
+ * are only waited on before their buffer is reused two windows later,
+ * so they overlap with simulation and with the next serialization.
+ */
+class RankSyncPersistentSkip : public RankSync
+{
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncPersistentSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncPersistentSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+
+    uint64_t getDataSize() const override;
+
+private:
+    static SimTime_t myNextSyncTime;
+
+    // Slots never grow past this size, larger windows always send the
+    // remainder as a second message
+    static const uint32_t max_slot_size = 64 * 1024;
+    // Slots never shrink below this size
+    static const uint32_t min_slot_size = 4096;
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    struct send_buffer
+    {
+        char*    buf;        // buffer the persistent request was created for
+        uint32_t slot_size;  // slot size the persistent request was created for
+        bool     active;     // sends have been started and not waited on
+#ifdef SST_CONFIG_HAVE_MPI
+        MPI_Request req;
+        MPI_Request overflow_req;
+        bool        overflow;
+#endif
+    };
+
+    struct comm_pair
+    {
+        SyncQueue*  squeue; // SyncQueue
+        send_buffer sbufs[2];
+        int         current;
+        uint32_t    send_slot_size;
+        uint32_t    send_high_water;
+
+        char*    rbuf; // receive buffer
+        uint32_t local_size;
+        uint32_t recv_slot_size;
+        uint32_t recv_high_water;
+        bool     recv_init;
+#ifdef SST_CONFIG_HAVE_MPI
+        MPI_Request recv_req;
+        MPI_Request overflow_req;
+        bool        overflow;
+#endif
+
+        // Size used by the untimed data exchange
+        uint32_t remote_size;
+
+        double mpiWaitTime;
+        double deserializeTime;
+    };
+
+    typedef std::map<int, comm_pair> comm_map_t;
+
+    comm_map_t comm_map;
+
+    static uint32_t nextSlotSize(uint32_t slot_size, uint32_t& high_water, uint32_t data_size);
+
+    void waitForSend(comm_pair& pair, send_buffer& sbuf);
+    void freeRequests();
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCPERSISTENTSKIP_H
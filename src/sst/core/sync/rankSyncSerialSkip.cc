@@ -62,7 +62,9 @@ RankSyncSerialSkip::RankSyncSerialSkip(RankInfo num_ranks, TimeConverter* UNUSED
 
 RankSyncSerialSkip::~RankSyncSerialSkip()
 {
+    SyncQueue::CompressionStats compression;
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        compression.add(i->second.squeue->getCompressionStats());
         delete i->second.squeue;
     }
     comm_map.clear();
@@ -71,6 +73,12 @@ RankSyncSerialSkip::~RankSyncSerialSkip()
         Output::getDefaultObject().verbose(
             CALL_INFO, 1, 0, "RankSyncSerialSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime,
             deserializeTime);
+    if ( compression.raw_bytes > 0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0,
+            "RankSyncSerialSkip compression: %" PRIu64 " -> %" PRIu64 " bytes (ratio %.2f)  compressTime: %lg sec\n",
+            compression.raw_bytes, compression.compressed_bytes,
+            (double)compression.raw_bytes / compression.compressed_bytes, compression.time);
 }
 
 ActivityQueue*
@@ -89,6 +97,7 @@ RankSyncSerialSkip::registerLink(
     }
 
     link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+    recordSendLatency(link);
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     link->setSendingComponentInfo("SYNC", "SYNC", "");
 #endif
@@ -195,12 +204,8 @@ RankSyncSerialSkip::exchange(void)
 
         auto deserialStart = SST::Core::Profile::now();
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        activities.clear();
-        ser& activities;
+        SyncQueue::unpackData(buffer, activities);
 
         deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 
@@ -226,17 +231,10 @@ RankSyncSerialSkip::exchange(void)
     // If we have an Exit object, fire it to see if we need end simulation
     // if ( exit != nullptr ) exit->check();
 
-    // Check to see when the next event is scheduled, then do an
-    // all_reduce with min operator and set next sync time to be
-    // min + max_period.
-
-    // Need to get the local minimum, then do a global minimum
-    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
-
-    myNextSyncTime = min_time + max_period->getFactor();
+    // Compute the next sync time.  This is the global minimum next
+    // activity time plus either the minimum partition latency or, with
+    // adaptive lookahead, the latency of each rank's own cut links.
+    myNextSyncTime = computeNextSyncTime();
 #endif
 }
 
@@ -303,11 +301,8 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        ser&                   activities;
+        SyncQueue::unpackData(buffer, activities);
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
             Event* ev = static_cast<Event*>(activities[j]);
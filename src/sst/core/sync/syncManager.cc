@@ -18,13 +18,16 @@
 #include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
+#include "sst/core/sync/rankSyncPersistentSkip.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
 #include "sst/core/sync/threadSyncQueue.h"
+#include "sst/core/sync/threadSyncSPSCSkip.h"
 #include "sst/core/sync/threadSyncSimpleSkip.h"
 #include "sst/core/timeConverter.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <sys/time.h>
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -145,6 +148,66 @@ public:
     }
 };
 
+RankSync::RankSync(RankInfo num_ranks) :
+    num_ranks(num_ranks),
+    min_send_latency(MAX_SIMTIME_T),
+    adaptive_lookahead(Simulation_impl::getSimulation()->adaptive_lookahead)
+{
+    link_maps.resize(num_ranks.rank);
+}
+
+// Largest adaptive lookahead window, in units of the minimum
+// partition latency, past the earliest activity on any rank
+static const SimTime_t ADAPTIVE_LOOKAHEAD_MAX_PERIODS = 100;
+
+SimTime_t
+RankSync::computeNextSyncTime()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Check to see when the next event is scheduled, then do an
+    // all_reduce with min operator.  Nothing can be sent to another
+    // rank before the next local activity, so the earliest an event
+    // can arrive is that time plus the latency of the link it is sent
+    // on.
+    SimTime_t next_activity = Simulation_impl::getLocalMinimumNextActivityTime();
+
+    if ( !adaptive_lookahead ) {
+        // Every rank uses the minimum partition latency, so the next
+        // sync is the global minimum next activity time plus that
+        // latency
+        SimTime_t min_time;
+        MPI_Allreduce(&next_activity, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+        return min_time + max_period->getFactor();
+    }
+
+    // Each rank advertises the earliest time one of its events could
+    // arrive on another rank, using the latencies of its own cut
+    // links.  Ranks with nothing scheduled or no cut links can't send
+    // anything until they receive events at the next sync.  The next
+    // local activity is reduced along with it so the window can be
+    // capped.
+    SimTime_t input[2] = { MAX_SIMTIME_T, next_activity };
+    if ( next_activity != MAX_SIMTIME_T && min_send_latency != MAX_SIMTIME_T ) {
+        if ( next_activity < MAX_SIMTIME_T - min_send_latency ) input[0] = next_activity + min_send_latency;
+    }
+    SimTime_t output[2];
+    MPI_Allreduce(input, output, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+
+    // Exit::check() only runs at rank syncs, so limit how far past
+    // the earliest activity the window can reach.  Otherwise the end
+    // of simulation could go unnoticed for an arbitrarily long time
+    // (or forever if no events ever cross a rank boundary).
+    SimTime_t next_sync  = output[0];
+    SimTime_t max_window = ADAPTIVE_LOOKAHEAD_MAX_PERIODS * max_period->getFactor();
+    if ( output[1] != MAX_SIMTIME_T && output[1] < MAX_SIMTIME_T - max_window ) {
+        next_sync = std::min(next_sync, output[1] + max_window);
+    }
+    return next_sync;
+#else
+    return MAX_SIMTIME_T;
+#endif
+}
+
 void
 RankSync::exchangeLinkInfo(uint32_t UNUSED_WO_MPI(my_rank))
 {
@@ -219,10 +282,12 @@ public:
             x->syncManagerStart();
     }
 
-    void syncManagerEnd()
+    void syncManagerEnd(uint32_t barriers)
     {
-        for ( auto* x : tools )
+        for ( auto* x : tools ) {
+            x->syncManagerBarriers(barriers);
             x->syncManagerEnd();
+        }
     }
 
     /**
@@ -255,10 +320,18 @@ SyncManager::SyncManager(
             b.resize(num_ranks.thread);
         }
         if ( min_part != MAX_SIMTIME_T ) {
-            if ( num_ranks.thread == 1 ) { rankSync = new RankSyncSerialSkip(num_ranks, minPartTC); }
-            else {
+            // Only the parallel sync can deliver events to multiple
+            // threads
+            const std::string& type = sim->rank_sync_type;
+            if ( num_ranks.thread > 1 || type == "parallel" ) {
                 rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
             }
+            else if ( type == "persistent" ) {
+                rankSync = new RankSyncPersistentSkip(num_ranks, minPartTC);
+            }
+            else {
+                rankSync = new RankSyncSerialSkip(num_ranks, minPartTC);
+            }
         }
         else {
             rankSync = new EmptyRankSync(num_ranks);
@@ -273,6 +346,9 @@ SyncManager::SyncManager(
         if ( Simulation_impl::getSimulation()->direct_interthread ) {
             threadSync = new ThreadSyncDirectSkip(num_ranks.thread, rank.thread, Simulation_impl::getSimulation());
         }
+        else if ( Simulation_impl::getSimulation()->thread_sync_type == "spsc" ) {
+            threadSync = new ThreadSyncSPSCSkip(num_ranks.thread, rank.thread, Simulation_impl::getSimulation());
+        }
         else {
             threadSync = new ThreadSyncSimpleSkip(num_ranks.thread, rank.thread, Simulation_impl::getSimulation());
         }
@@ -328,7 +404,10 @@ SyncManager::execute(void)
 
     if ( profile_tools ) profile_tools->syncManagerStart();
 
-    switch ( next_sync_type ) {
+    // computeNextInsert() changes next_sync_type
+    sync_type_t sync_type = next_sync_type;
+
+    switch ( sync_type ) {
     case RANK:
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
@@ -377,7 +456,16 @@ SyncManager::execute(void)
     computeNextInsert();
     RankExecBarrier[5].wait();
 
-    if ( profile_tools ) profile_tools->syncManagerEnd();
+    if ( profile_tools ) {
+        // Every sync ends with RankExecBarrier[5], rank syncs also
+        // use RankExecBarrier[0-4]
+        uint32_t barriers = 1;
+        if ( sync_type == RANK )
+            barriers += 5;
+        else
+            barriers += threadSync->getBarriersPerExecute();
+        profile_tools->syncManagerEnd(barriers);
+    }
 
     SST_SYNC_PROFILE_STOP
 }
@@ -37,7 +37,7 @@ class SyncProfileTool;
 class RankSync
 {
 public:
-    RankSync(RankInfo num_ranks) : num_ranks(num_ranks) { link_maps.resize(num_ranks.rank); }
+    RankSync(RankInfo num_ranks);
     virtual ~RankSync() {}
 
     /** Register a Link which this Sync Object is responsible for */
@@ -64,6 +64,23 @@ protected:
 
     std::vector<std::map<std::string, uintptr_t>> link_maps;
 
+    /** Minimum latency of the links that send from this rank to
+     * another rank.  Only used with adaptive lookahead. */
+    SimTime_t min_send_latency;
+    bool      adaptive_lookahead;
+
+    /** Track the send latency of a link registered with the RankSync.
+     * The registered link is the receive side of the pair, so the
+     * latency comes from the link that sends into the SyncQueue. */
+    void recordSendLatency(Link* link)
+    {
+        if ( link->pair_link->latency < min_send_latency ) min_send_latency = link->pair_link->latency;
+    }
+
+    /** Compute the time of the next rank sync.  This is a collective
+     * call and needs to be called by every rank at each sync. */
+    SimTime_t computeNextSyncTime();
+
     void finalizeConfiguration(Link* link) { link->finalizeConfiguration(); }
 
     void prepareForCompleteInt(Link* link) { link->prepareForComplete(); }
@@ -92,6 +109,9 @@ public:
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
+    /** Number of barriers waited on in each call to execute() */
+    virtual uint32_t getBarriersPerExecute() const { return 0; }
+
     void           setMaxPeriod(TimeConverter* period) { max_period = period; }
     TimeConverter* getMaxPeriod() { return max_period; }
 
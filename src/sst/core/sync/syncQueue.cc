@@ -14,9 +14,16 @@
 #include "sst/core/sync/syncQueue.h"
 
 #include "sst/core/event.h"
+#include "sst/core/profile.h"
 #include "sst/core/serialization/serializer.h"
 #include "sst/core/simulation_impl.h"
 
+#include <algorithm>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
 #if SST_EVENT_PROFILING
 #define SST_EVENT_PROFILE_SIZE(events, bytes)                    \
     do {                                                         \
@@ -32,9 +39,70 @@ namespace SST {
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
-SyncQueue::SyncQueue() : ActivityQueue(), buffer(nullptr), buf_size(0) {}
+namespace {
+
+void
+packVarint(serializer& ser, uint64_t value)
+{
+    uint8_t bytes[10];
+    int     count = 0;
+    do {
+        bytes[count] = value & 0x7f;
+        value >>= 7;
+        if ( value != 0 ) bytes[count] |= 0x80;
+        count++;
+    } while ( value != 0 );
+    ::memcpy(ser.packer().next_str(count), bytes, count);
+}
+
+uint64_t
+unpackVarint(serializer& ser)
+{
+    uint64_t value = 0;
+    int      shift = 0;
+    uint8_t  byte;
+    do {
+        byte = *reinterpret_cast<uint8_t*>(ser.unpacker().next_str(1));
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        shift += 7;
+    } while ( byte & 0x80 );
+    return value;
+}
+
+// Delivery times are sent as zigzag encoded varints of the
+// difference from the previous event in the batch.  Events on a link
+// are usually close together in time, so this is typically one or two
+// bytes.
+void
+packTimeDelta(serializer& ser, SimTime_t prev, SimTime_t time)
+{
+    int64_t delta = static_cast<int64_t>(time - prev);
+    packVarint(ser, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+}
+
+SimTime_t
+unpackTimeDelta(serializer& ser, SimTime_t prev)
+{
+    uint64_t value = unpackVarint(ser);
+    int64_t  delta = static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    return prev + delta;
+}
+
+} // namespace
 
-SyncQueue::~SyncQueue() {}
+SyncQueue::SyncQueue() :
+    ActivityQueue(),
+    buffers { nullptr, nullptr },
+    buf_sizes { 0, 0 },
+    current(0),
+    compress_threshold(Simulation_impl::getSimulation()->rank_sync_compression)
+{}
+
+SyncQueue::~SyncQueue()
+{
+    delete[] buffers[0];
+    delete[] buffers[1];
+}
 
 bool
 SyncQueue::empty()
@@ -83,42 +151,218 @@ SyncQueue::clear()
     activities.clear();
 }
 
+void
+SyncQueue::reserveBuffer(size_t size)
+{
+    if ( buf_sizes[current] >= size ) return;
+    delete[] buffers[current];
+    buf_sizes[current] = size;
+    buffers[current]   = new char[size];
+}
+
 char*
 SyncQueue::getData()
 {
     std::lock_guard<Spinlock> lock(slock);
 
+    // Pack the events in a single pass, growing the current buffer if
+    // they don't fit.  The buffer is kept for later syncs, so growth
+    // is amortized over sync windows.
     serializer ser;
 
-    ser.start_sizing();
+    ser.start_packing_growable(buffers[current], buf_sizes[current]);
 
-    ser& activities;
+    // Leave room for the header, which is filled in once the size is
+    // known
+    ser.packer().next_str(sizeof(SyncQueue::Header));
 
-    size_t size = ser.size();
+    // Group the events by link.  The receiver has to insert the events
+    // in the order they were sent, since that breaks ties in the
+    // TimeVortex between events on different links, so if grouping
+    // moves any events their original positions are sent as well.
+    // The sort is stable so events on the same link stay in order.
+    auto by_link = [this](size_t lhs, size_t rhs) {
+        return static_cast<Event*>(activities[lhs])->delivery_info <
+               static_cast<Event*>(activities[rhs])->delivery_info;
+    };
 
-    SST_EVENT_PROFILE_SIZE(activities.size(), size)
+    size_t count = activities.size();
 
-    if ( buf_size < (size + sizeof(SyncQueue::Header)) ) {
-        if ( buffer != nullptr ) { delete[] buffer; }
-
-        buf_size = size + sizeof(SyncQueue::Header);
-        buffer   = new char[buf_size];
+    send_order.resize(count);
+    for ( size_t i = 0; i < count; i++ ) {
+        send_order[i] = i;
     }
+    uint8_t reordered = !std::is_sorted(send_order.begin(), send_order.end(), by_link);
+    if ( reordered ) std::stable_sort(send_order.begin(), send_order.end(), by_link);
+
+    // The delivery info, class and priority are sent once for each
+    // run of events that share them, so each event only carries its
+    // delivery time delta and its own data.  Each event is deleted as
+    // soon as it has been packed.
+    ser& count;
+    ser& reordered;
+    size_t start = 0;
+    while ( start < count ) {
+        Event*    first         = static_cast<Event*>(activities[send_order[start]]);
+        uintptr_t delivery_info = first->delivery_info;
+        uint32_t  cls_id        = first->cls_id();
+        int       priority      = first->getPriority();
+        uint32_t  tag           = first->getOrderTag();
+
+        size_t end = start + 1;
+        while ( end < count ) {
+            Event* ev = static_cast<Event*>(activities[send_order[end]]);
+            if ( ev->delivery_info != delivery_info || ev->cls_id() != cls_id || ev->getPriority() != priority ||
+                 ev->getOrderTag() != tag )
+                break;
+            end++;
+        }
 
-    ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
+        uint32_t batch_count = end - start;
 
-    ser& activities;
+        ser& delivery_info;
+        ser& cls_id;
+        ser& priority;
+        ser& tag;
+        ser& batch_count;
 
-    // Delete all the events
-    for ( unsigned int i = 0; i < activities.size(); i++ ) {
-        delete activities[i];
+        SimTime_t prev_time = 0;
+        for ( size_t i = start; i < end; i++ ) {
+            Event* ev = static_cast<Event*>(activities[send_order[i]]);
+            if ( reordered ) packVarint(ser, send_order[i]);
+            packTimeDelta(ser, prev_time, ev->getDeliveryTime());
+            prev_time = ev->getDeliveryTime();
+            // Only the event itself leaves out its header, any
+            // Activities in its data are sent whole
+            ser.set_skip_activity_header(true);
+            ev->serialize_order(ser);
+            delete ev;
+        }
+        start = end;
     }
     activities.clear();
 
+    char*  buffer      = ser.packer().buffer();
+    size_t size        = ser.size();
+    buffers[current]   = buffer;
+    buf_sizes[current] = ser.packer().max_size();
+
+    SST_EVENT_PROFILE_SIZE(count, size - sizeof(SyncQueue::Header))
+
+    SyncQueue::Header* hdr = static_cast<SyncQueue::Header*>(static_cast<void*>(buffer));
+    hdr->uncompressed_size = 0;
+    if ( compress_threshold > 0 && size - sizeof(SyncQueue::Header) > compress_threshold )
+        size = compress(buffer, size);
+
     // Set the size field in the header
-    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
+    hdr->buffer_size = size;
 
     return buffer;
 }
 
+size_t
+SyncQueue::compress(char* buffer, size_t size)
+{
+#ifdef HAVE_LIBZ
+    auto start = SST::Core::Profile::now();
+
+    // Compress into a scratch buffer and only copy back if it got
+    // smaller.  The fastest zlib level is used since this is on the
+    // critical path of the sync.
+    uLong  data_size = size - sizeof(SyncQueue::Header);
+    uLongf dest_size = compressBound(data_size);
+    if ( compress_buf.size() < dest_size ) compress_buf.resize(dest_size);
+
+    int ret = compress2(
+        reinterpret_cast<Bytef*>(compress_buf.data()), &dest_size,
+        reinterpret_cast<Bytef*>(&buffer[sizeof(SyncQueue::Header)]), data_size, Z_BEST_SPEED);
+
+    compression_stats.raw_bytes += data_size;
+    if ( ret == Z_OK && dest_size < data_size ) {
+        ::memcpy(&buffer[sizeof(SyncQueue::Header)], compress_buf.data(), dest_size);
+        reinterpret_cast<SyncQueue::Header*>(buffer)->uncompressed_size = data_size;
+        size = sizeof(SyncQueue::Header) + dest_size;
+    }
+    compression_stats.compressed_bytes += size - sizeof(SyncQueue::Header);
+    compression_stats.time += SST::Core::Profile::getElapsed(start);
+#else
+    (void)buffer;
+#endif
+    return size;
+}
+
+void
+SyncQueue::unpackData(char* buffer, std::vector<Activity*>& activities)
+{
+    SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+    char*              data = &buffer[sizeof(SyncQueue::Header)];
+    size_t             size = hdr->buffer_size - sizeof(SyncQueue::Header);
+
+#ifdef HAVE_LIBZ
+    // The rank syncs can call this from several threads at once, so
+    // each thread gets its own scratch buffer
+    static thread_local std::vector<char> uncompress_buf;
+    if ( hdr->uncompressed_size != 0 ) {
+        uLongf dest_size = hdr->uncompressed_size;
+        if ( uncompress_buf.size() < dest_size ) uncompress_buf.resize(dest_size);
+        int ret = uncompress(
+            reinterpret_cast<Bytef*>(uncompress_buf.data()), &dest_size, reinterpret_cast<Bytef*>(data), size);
+        if ( ret != Z_OK || dest_size != hdr->uncompressed_size ) {
+            Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: Unable to uncompress rank sync data (zlib error %d)\n", ret);
+        }
+        data = uncompress_buf.data();
+        size = dest_size;
+    }
+#endif
+
+    serializer ser;
+    ser.start_unpacking(data, size);
+
+    size_t  count     = 0;
+    uint8_t reordered = 0;
+    ser&    count;
+    ser&    reordered;
+
+    // Events that were moved into batches are put back at the
+    // position they were sent in
+    size_t base = activities.size();
+    if ( reordered )
+        activities.resize(base + count);
+    else
+        activities.reserve(base + count);
+
+    while ( count > 0 ) {
+        uintptr_t delivery_info = 0;
+        uint32_t  cls_id        = 0;
+        int       priority      = 0;
+        uint32_t  tag           = 0;
+        uint32_t  batch_count   = 0;
+
+        ser& delivery_info;
+        ser& cls_id;
+        ser& priority;
+        ser& tag;
+        ser& batch_count;
+
+        SimTime_t time = 0;
+        for ( uint32_t i = 0; i < batch_count; i++ ) {
+            size_t position = reordered ? unpackVarint(ser) : 0;
+            time            = unpackTimeDelta(ser, time);
+
+            Event* ev = static_cast<Event*>(static_cast<Activity*>(serializable_factory::get_serializable(cls_id)));
+            ser.set_skip_activity_header(true);
+            ev->serialize_order(ser);
+            ev->setDeliveryTime(time);
+            ev->setPriority(priority);
+            ev->setDeliveryInfo(tag, delivery_info);
+            if ( reordered )
+                activities[base + position] = ev;
+            else
+                activities.push_back(ev);
+        }
+        count -= batch_count;
+    }
+}
+
 } // namespace SST
@@ -34,6 +34,26 @@ public:
         uint32_t mode;
         uint32_t count;
         uint32_t buffer_size;
+        // Size of the data after the header before it was compressed,
+        // or 0 if the data isn't compressed
+        uint32_t uncompressed_size;
+    };
+
+    /** Totals for the buffers that were big enough to be compressed */
+    struct CompressionStats
+    {
+        uint64_t raw_bytes;
+        uint64_t compressed_bytes;
+        double   time;
+
+        CompressionStats() : raw_bytes(0), compressed_bytes(0), time(0.0) {}
+
+        void add(const CompressionStats& other)
+        {
+            raw_bytes += other.raw_bytes;
+            compressed_bytes += other.compressed_bytes;
+            time += other.time;
+        }
     };
 
     SyncQueue();
@@ -48,15 +68,51 @@ public:
     // Not part of the ActivityQueue interface
     /** Clear elements from the queue */
     void  clear();
-    /** Accessor method to the internal queue */
+    /** Pack the queued events into the current buffer and return it.
+     * Events are sent in batches that share a link, class and
+     * priority, so those fields are sent once per batch and the
+     * delivery times are delta encoded.  If the data is larger than
+     * the --rank-sync-compression threshold, it is compressed. */
     char* getData();
 
-    uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
+    /** Unpack the events in a buffer created by getData() and append
+     * them to activities */
+    static void unpackData(char* buffer, std::vector<Activity*>& activities);
+
+    /** Switch to the other of the two internal buffers.  The buffer
+     * returned by the last call to getData() is left untouched until
+     * the next call to swapBuffers(), so it can still be in use (for
+     * instance by a pending send) while the next one is filled. */
+    void swapBuffers() { current ^= 1; }
+    /** Make sure the current buffer is at least size bytes */
+    void reserveBuffer(size_t size);
+    /** Return the size of the current buffer */
+    size_t getBufferSize() const { return buf_sizes[current]; }
+
+    uint64_t getDataSize()
+    {
+        return buf_sizes[0] + buf_sizes[1] + (activities.capacity() * sizeof(Activity*)) +
+               (send_order.capacity() * sizeof(size_t));
+    }
+
+    /** Return the compression totals for this queue */
+    const CompressionStats& getCompressionStats() const { return compression_stats; }
 
 private:
-    char*                  buffer;
-    size_t                 buf_size;
+    /** Compress the data in buffer in place if that makes it smaller.
+     * Returns the new size of the buffer. */
+    size_t compress(char* buffer, size_t size);
+
+    char*                  buffers[2];
+    size_t                 buf_sizes[2];
+    int                    current;
     std::vector<Activity*> activities;
+    // Order the activities are packed in, kept between syncs
+    std::vector<size_t>    send_order;
+
+    size_t            compress_threshold;
+    std::vector<char> compress_buf;
+    CompressionStats  compression_stats;
 
     Core::ThreadSafe::Spinlock slock;
 };
@@ -57,6 +57,8 @@ public:
         return nullptr;
     }
 
+    uint32_t getBarriersPerExecute() const override { return 1; }
+
     uint64_t getDataSize() const;
 
 private:
@@ -0,0 +1,171 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_THREADSYNCSPSCQUEUE_H
+#define SST_CORE_SYNC_THREADSYNCSPSCQUEUE_H
+
+#include "sst/core/activityQueue.h"
+#include "sst/core/threadsafe.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace SST {
+
+/** Unbounded single producer, single consumer queue of Activities.
+
+    Used to pass events between one pair of threads.  The sending
+    thread inserts without taking any locks and the receiving thread
+    can pop at any time, including while the sender is still
+    inserting.  The queue is a linked list of fixed size blocks.  The
+    receiver hands the last block it finished with back to the sender
+    to reuse, so steady state operation does not allocate.
+ */
+class ThreadSyncSPSCQueue : public ActivityQueue
+{
+public:
+    ThreadSyncSPSCQueue() : ActivityQueue(), spare(nullptr), num_blocks(1)
+    {
+        Block* block = new Block();
+        head_block   = block;
+        head_pos     = 0;
+        tail_block   = block;
+        tail_pos     = 0;
+        pushed       = 0;
+        popped       = 0;
+    }
+
+    ~ThreadSyncSPSCQueue()
+    {
+        while ( head_block != nullptr ) {
+            Block* next = head_block->next.load(std::memory_order_relaxed);
+            delete head_block;
+            head_block = next;
+        }
+        delete spare.load(std::memory_order_relaxed);
+    }
+
+    // The members are cache line aligned, which the global operator
+    // new doesn't guarantee before C++17
+    static void* operator new(size_t size)
+    {
+        void* ptr = nullptr;
+        if ( posix_memalign(&ptr, 64, size) != 0 ) throw std::bad_alloc();
+        return ptr;
+    }
+    static void operator delete(void* ptr) { ::free(ptr); }
+
+    /** Returns true if the queue is empty.  Only valid on the
+     * receiving thread. */
+    bool empty() override { return peek() == nullptr; }
+
+    /** Returns the number of activities in the queue.  This is only a
+     * snapshot if the sending thread is still inserting. */
+    int size() override
+    {
+        return pushed.load(std::memory_order_acquire) - popped.load(std::memory_order_relaxed);
+    }
+
+    /** Remove and return the next activity, or nullptr if the queue is
+     * empty.  Only call from the receiving thread. */
+    Activity* pop() override
+    {
+        Activity* ret = peek();
+        if ( ret != nullptr ) {
+            head_pos++;
+            popped.store(popped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        return ret;
+    }
+
+    /** Insert a new activity into the queue.  Only call from the
+     * sending thread. */
+    void insert(Activity* activity) override
+    {
+        if ( tail_pos == block_size ) {
+            // Reuse the block the receiver is done with, if there is one
+            Block* block = spare.exchange(nullptr, std::memory_order_acquire);
+            if ( block == nullptr ) {
+                block = new Block();
+                num_blocks.fetch_add(1, std::memory_order_relaxed);
+            }
+            block->count.store(0, std::memory_order_relaxed);
+            block->next.store(nullptr, std::memory_order_relaxed);
+            tail_block->next.store(block, std::memory_order_release);
+            tail_block = block;
+            tail_pos   = 0;
+        }
+        tail_block->items[tail_pos++] = activity;
+        tail_block->count.store(tail_pos, std::memory_order_release);
+        pushed.store(pushed.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /** Returns the next activity without removing it, or nullptr if
+     * the queue is empty.  Only call from the receiving thread. */
+    Activity* front() override { return peek(); }
+
+    /** Returns the number of bytes held in blocks by the queue,
+     * including the spare block.  Can be called from any thread. */
+    uint64_t getDataSize() const { return num_blocks.load(std::memory_order_relaxed) * sizeof(Block); }
+
+private:
+    static const uint32_t block_size = 1024;
+
+    struct Block
+    {
+        Activity*             items[block_size];
+        std::atomic<uint32_t> count;
+        std::atomic<Block*>   next;
+
+        Block() : count(0), next(nullptr) {}
+    };
+
+    Activity* peek()
+    {
+        while ( true ) {
+            if ( head_pos < head_block->count.load(std::memory_order_acquire) ) return head_block->items[head_pos];
+            if ( head_pos < block_size ) return nullptr;
+
+            // Finished this block, move to the next one if the sender
+            // has started it
+            Block* next = head_block->next.load(std::memory_order_acquire);
+            if ( next == nullptr ) return nullptr;
+            Block* old = spare.exchange(head_block, std::memory_order_release);
+            if ( old != nullptr ) {
+                delete old;
+                num_blocks.fetch_sub(1, std::memory_order_relaxed);
+            }
+            head_block = next;
+            head_pos   = 0;
+        }
+    }
+
+    // Receiver side
+    CACHE_ALIGNED(Block*, head_block);
+    uint32_t              head_pos;
+    std::atomic<uint64_t> popped;
+
+    // Sender side
+    CACHE_ALIGNED(Block*, tail_block);
+    uint32_t              tail_pos;
+    std::atomic<uint64_t> pushed;
+
+    // Block handed back from the receiver to the sender
+    CACHE_ALIGNED(std::atomic<Block*>, spare);
+
+    // Blocks currently allocated, only used for reporting
+    std::atomic<uint64_t> num_blocks;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_THREADSYNCSPSCQUEUE_H
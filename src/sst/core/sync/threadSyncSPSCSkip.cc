@@ -0,0 +1,216 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/threadSyncSPSCSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/link.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeConverter.h"
+
+#include <cstdlib>
+
+namespace SST {
+
+ThreadSyncSPSCSkip::NextActivity* ThreadSyncSPSCSkip::next_activity = nullptr;
+
+/** Create a new ThreadSyncSPSCSkip object */
+ThreadSyncSPSCSkip::ThreadSyncSPSCSkip(int num_threads, int thread, Simulation_impl* sim) :
+    ThreadSync(),
+    num_threads(num_threads),
+    thread(thread),
+    sim(sim),
+    totalWaitTime(0.0)
+{
+    for ( int i = 0; i < num_threads; i++ ) {
+        queues.push_back(new ThreadSyncSPSCQueue());
+    }
+
+    if ( sim->getRank().thread == 0 ) {
+        barrier[0].resize(num_threads);
+        barrier[1].resize(num_threads);
+        // posix_memalign because new doesn't honor the cache line
+        // alignment before C++17
+        void* ptr = nullptr;
+        if ( posix_memalign(&ptr, 64, num_threads * sizeof(NextActivity)) != 0 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ThreadSyncSPSCSkip failed to allocate space for %d threads\n", num_threads);
+        }
+        next_activity = static_cast<NextActivity*>(ptr);
+        for ( int i = 0; i < num_threads; i++ ) {
+            next_activity[i].time = 0;
+        }
+    }
+
+    my_max_period = sim->getInterThreadMinLatency();
+    nextSyncTime  = my_max_period;
+}
+
+ThreadSyncSPSCSkip::~ThreadSyncSPSCSkip()
+{
+    if ( totalWaitTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "ThreadSyncSPSCSkip total wait time: %lg seconds.\n", totalWaitTime);
+    for ( int i = 0; i < num_threads; i++ ) {
+        delete queues[i];
+    }
+    queues.clear();
+    if ( thread == 0 ) {
+        ::free(next_activity);
+        next_activity = nullptr;
+    }
+}
+
+void
+ThreadSyncSPSCSkip::registerLink(const std::string& name, Link* link)
+{
+    auto iter = link_map.find(name);
+    if ( iter == link_map.end() ) {
+        // I have initialized first, so just put the name and link in
+        // the map
+        link_map[name] = link;
+    }
+    else {
+        // I already have the remote info, so initialize the link data
+        Link* remote_link = iter->second;
+        setLinkDeliveryInfo(link, reinterpret_cast<uintptr_t>(remote_link));
+        link_map.erase(iter);
+    }
+}
+
+ActivityQueue*
+ThreadSyncSPSCSkip::registerRemoteLink(int tid, const std::string& name, Link* link)
+{
+    auto iter = link_map.find(name);
+    if ( iter == link_map.end() ) {
+        // I have initialized first, so just put the name and link in
+        // the map
+        link_map[name] = link;
+    }
+    else {
+        // I already have the local info, so initialize the link data
+        Link* local_link = iter->second;
+        setLinkDeliveryInfo(local_link, reinterpret_cast<uintptr_t>(link));
+        link_map.erase(iter);
+    }
+    // Thread tid is the only thread that sends into this queue
+    return queues[tid];
+}
+
+size_t
+ThreadSyncSPSCSkip::drainQueues()
+{
+    // Events in the queues were sent no earlier than the last sync
+    // and have at least the minimum interthread latency, so they
+    // can't be earlier than the current time on this thread
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+    size_t    count         = 0;
+    for ( size_t i = 0; i < queues.size(); i++ ) {
+        ThreadSyncSPSCQueue* queue = queues[i];
+        Activity*            act;
+        while ( (act = queue->pop()) != nullptr ) {
+            Event*    ev    = static_cast<Event*>(act);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+            count++;
+        }
+    }
+    return count;
+}
+
+void
+ThreadSyncSPSCSkip::before()
+{
+    drainQueues();
+}
+
+void
+ThreadSyncSPSCSkip::after()
+{
+    // Only called as part of a rank sync, so all the threads are
+    // stopped and we can look at every TimeVortex
+    auto nextmin     = sim->getLocalMinimumNextActivityTime();
+    auto nextminPlus = nextmin + my_max_period;
+    nextSyncTime     = nextmin > nextminPlus ? nextmin : nextminPlus;
+}
+
+void
+ThreadSyncSPSCSkip::execute()
+{
+    // Deliver events as they show up while waiting for the other
+    // threads to get here
+    totalWaitTime += barrier[0].wait([this]() { return drainQueues() != 0; });
+
+    // Every thread has finished sending for this window, so get what
+    // is left and publish this thread's next activity time
+    drainQueues();
+    next_activity[thread].time = sim->getNextActivityTime();
+
+    totalWaitTime += barrier[1].wait();
+
+    // No one writes next_activity again until every thread has
+    // passed barrier[0] of the next sync, so no third barrier is
+    // needed
+    SimTime_t nextmin = MAX_SIMTIME_T;
+    for ( int i = 0; i < num_threads; i++ ) {
+        if ( next_activity[i].time < nextmin ) nextmin = next_activity[i].time;
+    }
+    auto nextminPlus = nextmin + my_max_period;
+    nextSyncTime     = nextmin > nextminPlus ? nextmin : nextminPlus;
+}
+
+void
+ThreadSyncSPSCSkip::processLinkUntimedData()
+{
+    // Need to walk through all the queues and send the data to the
+    // correct links
+    for ( int i = 0; i < num_threads; i++ ) {
+        ThreadSyncSPSCQueue* queue = queues[i];
+        Activity*            act;
+        while ( (act = queue->pop()) != nullptr ) {
+            Event* ev = static_cast<Event*>(act);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+}
+
+void
+ThreadSyncSPSCSkip::finalizeLinkConfigurations()
+{
+    for ( auto i = link_map.begin(); i != link_map.end(); ++i ) {
+        finalizeConfiguration(i->second);
+    }
+}
+
+void
+ThreadSyncSPSCSkip::prepareForComplete()
+{
+    for ( auto i = link_map.begin(); i != link_map.end(); ++i ) {
+        prepareForCompleteInt(i->second);
+    }
+}
+
+uint64_t
+ThreadSyncSPSCSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( auto* queue : queues ) {
+        count += queue->getDataSize();
+    }
+    return count;
+}
+
+Core::ThreadSafe::Barrier ThreadSyncSPSCSkip::barrier[2];
+
+} // namespace SST
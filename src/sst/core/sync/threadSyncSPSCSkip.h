@@ -0,0 +1,92 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_THREADSYNCSPSCSKIP_H
+#define SST_CORE_SYNC_THREADSYNCSPSCSKIP_H
+
+#include "sst/core/action.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/sync/threadSyncSPSCQueue.h"
+
+#include <unordered_map>
+
+namespace SST {
+
+class ActivityQueue;
+class Link;
+class TimeConverter;
+class Exit;
+class Event;
+class Simulation_impl;
+
+/**
+   ThreadSync that uses a lock-free single producer, single consumer
+   queue for each pair of threads.  Receiving threads deliver events
+   from their queues while waiting for the other threads to reach the
+   sync, and each thread publishes its own next activity time so a
+   thread-only sync needs two barriers instead of three.
+ */
+class ThreadSyncSPSCSkip : public ThreadSync
+{
+public:
+    /** Create a new ThreadSync object */
+    ThreadSyncSPSCSkip(int num_threads, int thread, Simulation_impl* sim);
+    ~ThreadSyncSPSCSkip();
+
+    void before() override;
+    void after() override;
+    void execute(void) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void processLinkUntimedData() override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    void prepareForComplete() override;
+
+    /** Register a Link which this Sync Object is responsible for */
+    void           registerLink(const std::string& name, Link* link) override;
+    ActivityQueue* registerRemoteLink(int tid, const std::string& name, Link* link) override;
+
+    uint32_t getBarriersPerExecute() const override { return 2; }
+
+    uint64_t getDataSize() const;
+
+private:
+    /** Send all events currently in the queues on to their links.
+     * Returns the number of events delivered. */
+    size_t drainQueues();
+
+    // Each thread's next activity time, padded to a cache line
+    struct CACHE_ALIGNED_T NextActivity
+    {
+        SimTime_t time;
+    };
+
+    // Stores the links until they can be intialized with the right
+    // remote data.  It will hold whichever thread registers the link
+    // first and will be removed after the second thread registers and
+    // the link is properly initialized with the remote data.
+    std::unordered_map<std::string, Link*> link_map;
+
+    std::vector<ThreadSyncSPSCQueue*> queues;
+    SimTime_t                         my_max_period;
+    int                               num_threads;
+    int                               thread;
+    Simulation_impl*                  sim;
+    static NextActivity*              next_activity;
+    static Core::ThreadSafe::Barrier  barrier[2];
+    double                            totalWaitTime;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_THREADSYNCSPSCSKIP_H
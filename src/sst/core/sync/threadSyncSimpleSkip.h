@@ -52,6 +52,8 @@ public:
     void           registerLink(const std::string& name, Link* link) override;
     ActivityQueue* registerRemoteLink(int tid, const std::string& name, Link* link) override;
 
+    uint32_t getBarriersPerExecute() const override { return 3; }
+
     uint64_t getDataSize() const;
 
     // static void disable() { disabled = true; barrier.disable(); }
@@ -0,0 +1,96 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_IdleClockComponent.h"
+
+#include "sst/core/event.h"
+
+using namespace SST;
+using namespace SST::CoreTestIdleClockComponent;
+
+coreTestIdleClockComponent::coreTestIdleClockComponent(ComponentId_t id, Params& params) :
+    Component(id),
+    pending(0),
+    sent(0),
+    received(0),
+    ticks(0)
+{
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    my_id        = params.find<int>("id", 0);
+    initiator    = params.find<bool>("initiator", false);
+    num_messages = params.find<int>("num_messages", 10);
+    sleep_cycles = params.find<Cycle_t>("sleep_cycles", 0);
+
+    link = configureLink(
+        "port", new Event::Handler<coreTestIdleClockComponent>(this, &coreTestIdleClockComponent::handleEvent));
+    if ( !link ) { fatal(CALL_INFO, -1, "Failed to configure port\n"); }
+
+    clock_handler = new Clock::Handler<coreTestIdleClockComponent>(this, &coreTestIdleClockComponent::tick);
+    tc            = registerClock(params.find<std::string>("clock", "1GHz"), clock_handler);
+}
+
+void
+coreTestIdleClockComponent::handleEvent(Event* ev)
+{
+    delete ev;
+    pending++;
+}
+
+bool
+coreTestIdleClockComponent::tick(Cycle_t cycle)
+{
+    ticks++;
+
+    bool send = false;
+    if ( initiator && sent == 0 ) { send = true; }
+
+    if ( pending > 0 ) {
+        pending--;
+        received++;
+        getSimulationOutput().output(
+            "%d: received message %d on cycle %" PRIu64 " at %" PRIu64 " ns\n", my_id, received, cycle,
+            getCurrentSimTimeNano());
+        if ( sent < num_messages ) send = true;
+        if ( received == num_messages ) primaryComponentOKToEndSim();
+    }
+
+    if ( send ) {
+        link->send(nullptr);
+        sent++;
+    }
+
+    // Nothing left to do until the next message shows up
+    if ( pending == 0 ) {
+        if ( received == num_messages ) { suspendClock(tc, clock_handler, MAX_SIMTIME_T); }
+        else {
+            suspendClock(tc, clock_handler, "port", sleep_cycles ? cycle + sleep_cycles : MAX_SIMTIME_T);
+        }
+    }
+
+    // return false so we keep going
+    return false;
+}
+
+void
+coreTestIdleClockComponent::finish()
+{
+    getSimulationOutput().output(
+        "%d: sent %d messages, received %d messages in %" PRIu64 " clock ticks\n", my_id, sent, received, ticks);
+}
@@ -0,0 +1,91 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_IDLECLOCKCOMPONENT_H
+#define SST_CORE_CORETEST_IDLECLOCKCOMPONENT_H
+
+#include "sst/core/component.h"
+#include "sst/core/link.h"
+
+namespace SST {
+namespace CoreTestIdleClockComponent {
+
+/**
+ * Bounces messages back and forth with another instance.  The clock
+ * handler suspends itself whenever there is nothing to do and is woken
+ * up by the arrival of the next message, or optionally after a fixed
+ * number of cycles.
+ */
+class coreTestIdleClockComponent : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestIdleClockComponent,
+        "coreTestElement",
+        "coreTestIdleClockComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Idle clock skipping test component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "id",           "ID of component", "0" },
+        { "clock",        "Clock frequency", "1GHz" },
+        { "initiator",    "Whether this component sends the first message", "false" },
+        { "num_messages", "Number of messages to send", "10" },
+        { "sleep_cycles", "If not 0, also wake up the clock handler after this many cycles", "0" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS()
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port", "Link to the other component", { "NullEvent", "" } }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestIdleClockComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestIdleClockComponent() {}
+
+    void setup() {}
+    void finish();
+
+private:
+    void handleEvent(SST::Event* ev);
+    bool tick(SST::Cycle_t cycle);
+
+    SST::Link*          link;
+    TimeConverter*      tc;
+    Clock::HandlerBase* clock_handler;
+
+    int     my_id;
+    bool    initiator;
+    int     num_messages;
+    Cycle_t sleep_cycles;
+
+    int      pending;
+    int      sent;
+    int      received;
+    uint64_t ticks;
+};
+
+} // namespace CoreTestIdleClockComponent
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_IDLECLOCKCOMPONENT_H
@@ -19,15 +19,18 @@
 
 #include "sst/core/testElements/coreTest_Serialization.h"
 
+#include "sst/core/event.h"
 #include "sst/core/link.h"
 #include "sst/core/objectSerialization.h"
 #include "sst/core/rng/mersenne.h"
 #include "sst/core/rng/rng.h"
 #include "sst/core/warnmacros.h"
 
+#include <chrono>
 #include <deque>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -36,6 +39,212 @@
 namespace SST {
 namespace CoreTestSerialization {
 
+// Payloads for the event serialization benchmark, modeled after the
+// headers of typical network and memory events
+struct NetworkPayload
+{
+    uint64_t src;
+    uint64_t dest;
+    uint64_t trace_id;
+    uint64_t injection_time;
+    uint32_t size_in_bits;
+    uint32_t vn;
+
+    bool operator==(const NetworkPayload& o) const
+    {
+        return src == o.src && dest == o.dest && trace_id == o.trace_id && injection_time == o.injection_time &&
+               size_in_bits == o.size_in_bits && vn == o.vn;
+    }
+
+    bool operator!=(const NetworkPayload& o) const { return !(*this == o); }
+};
+
+struct MemoryPayload
+{
+    uint64_t addr;
+    uint64_t base_addr;
+    uint64_t id;
+    uint64_t flags;
+    uint32_t size;
+    uint32_t cmd;
+    uint32_t src;
+    uint32_t dst;
+
+    bool operator==(const MemoryPayload& o) const
+    {
+        return addr == o.addr && base_addr == o.base_addr && id == o.id && flags == o.flags && size == o.size &&
+               cmd == o.cmd && src == o.src && dst == o.dst;
+    }
+};
+
+} // namespace CoreTestSerialization
+} // namespace SST
+
+ImplementTriviallySerializable(SST::CoreTestSerialization::NetworkPayload);
+ImplementTriviallySerializable(SST::CoreTestSerialization::MemoryPayload);
+
+namespace SST {
+namespace CoreTestSerialization {
+
+// Serializes the payload one field at a time
+class BenchmarkNetworkEvent : public SST::Event
+{
+public:
+    NetworkPayload payload;
+
+    void fill(SST::RNG::Random* rng)
+    {
+        payload.src            = rng->generateNextUInt64();
+        payload.dest           = rng->generateNextUInt64();
+        payload.trace_id       = rng->generateNextUInt64();
+        payload.injection_time = rng->generateNextUInt64();
+        payload.size_in_bits   = rng->generateNextUInt32();
+        payload.vn             = rng->generateNextUInt32();
+    }
+
+    bool matches(const BenchmarkNetworkEvent& o) const { return payload == o.payload; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& payload.src;
+        ser& payload.dest;
+        ser& payload.trace_id;
+        ser& payload.injection_time;
+        ser& payload.size_in_bits;
+        ser& payload.vn;
+    }
+
+    ImplementSerializable(SST::CoreTestSerialization::BenchmarkNetworkEvent);
+};
+
+// Serializes the payload with a single copy
+class BenchmarkNetworkEventBulk : public BenchmarkNetworkEvent
+{
+public:
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& payload;
+    }
+
+    ImplementSerializable(SST::CoreTestSerialization::BenchmarkNetworkEventBulk);
+};
+
+// Serializes the payload one field at a time and the data one byte
+// at a time
+class BenchmarkMemoryEvent : public SST::Event
+{
+public:
+    MemoryPayload        payload;
+    std::vector<uint8_t> data;
+
+    void fill(SST::RNG::Random* rng)
+    {
+        payload.addr      = rng->generateNextUInt64();
+        payload.base_addr = rng->generateNextUInt64();
+        payload.id        = rng->generateNextUInt64();
+        payload.flags     = rng->generateNextUInt64();
+        payload.size      = 64;
+        payload.cmd       = rng->generateNextUInt32();
+        payload.src       = rng->generateNextUInt32();
+        payload.dst       = rng->generateNextUInt32();
+        data.resize(payload.size);
+        for ( auto& x : data )
+            x = rng->generateNextUInt32();
+    }
+
+    bool matches(const BenchmarkMemoryEvent& o) const { return payload == o.payload && data == o.data; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& payload.addr;
+        ser& payload.base_addr;
+        ser& payload.id;
+        ser& payload.flags;
+        ser& payload.size;
+        ser& payload.cmd;
+        ser& payload.src;
+        ser& payload.dst;
+
+        // Same format as serializing the vector, but without the bulk
+        // copy
+        size_t size = data.size();
+        ser&   size;
+        data.resize(size);
+        for ( auto& x : data )
+            ser& x;
+    }
+
+    ImplementSerializable(SST::CoreTestSerialization::BenchmarkMemoryEvent);
+};
+
+// Serializes the payload and the data with a single copy each
+class BenchmarkMemoryEventBulk : public BenchmarkMemoryEvent
+{
+public:
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& payload;
+        ser& data;
+    }
+
+    ImplementSerializable(SST::CoreTestSerialization::BenchmarkMemoryEventBulk);
+};
+
+// Packs and unpacks count events through Event pointers, the same
+// way they go through a SyncQueue, and reports the throughput
+template <typename T>
+void
+runEventBenchmark(Output& out, const char* name, uint64_t count, SST::RNG::Random* rng)
+{
+    std::vector<Event*> events_in;
+    for ( uint64_t i = 0; i < count; ++i ) {
+        T* ev = new T();
+        ev->fill(rng);
+        events_in.push_back(ev);
+    }
+
+    SST::Core::Serialization::serializer ser;
+
+    ser.start_sizing();
+    for ( auto& ev : events_in )
+        ser& ev;
+    size_t size   = ser.size();
+    char*  buffer = new char[size];
+
+    auto start = std::chrono::steady_clock::now();
+    ser.start_packing(buffer, size);
+    for ( auto& ev : events_in )
+        ser& ev;
+    auto pack_end = std::chrono::steady_clock::now();
+
+    std::vector<Event*> events_out(count, nullptr);
+    ser.start_unpacking(buffer, size);
+    for ( auto& ev : events_out )
+        ser& ev;
+    auto unpack_end = std::chrono::steady_clock::now();
+
+    bool passed = true;
+    for ( uint64_t i = 0; i < count; ++i ) {
+        T* ev_out = dynamic_cast<T*>(events_out[i]);
+        if ( ev_out == nullptr || !static_cast<T*>(events_in[i])->matches(*ev_out) ) passed = false;
+        delete events_in[i];
+        delete events_out[i];
+    }
+    delete[] buffer;
+    if ( !passed ) out.output("ERROR: %s events did not serialize/deserialize properly\n", name);
+
+    double pack_time   = std::chrono::duration<double>(pack_end - start).count();
+    double unpack_time = std::chrono::duration<double>(unpack_end - pack_end).count();
+    out.output(
+        "benchmark %s: %" PRIu64 " events, %.1f bytes/event: pack %.3f MB/s, unpack %.3f MB/s\n", name, count,
+        count > 0 ? (double)size / count : 0.0, pack_time > 0 ? size / pack_time / 1e6 : 0.0,
+        unpack_time > 0 ? size / unpack_time / 1e6 : 0.0);
+}
+
 
 template <typename T>
 bool
@@ -97,7 +306,7 @@ checkUContainerSerializeDeserialize(T& data)
     return true;
 };
 
-coreTestSerialization::coreTestSerialization(ComponentId_t id, UNUSED(Params& params)) : Component(id)
+coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) : Component(id)
 {
     Output& out = getSimulationOutput();
 
@@ -217,6 +426,103 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, UNUSED(Params& pa
             out.output("ERROR: serializing as map<string,uintptr_t> and deserializing to "
                        "vector<pair<string,uintptr_t>> did not work properly\n");
     }
+
+    {
+        // Pack into a growable buffer that starts out too small, so it
+        // has to grow several times, and make sure everything unpacks
+        std::vector<std::string> strings_in;
+        for ( int i = 0; i < 100; ++i )
+            strings_in.push_back(std::to_string(rng->generateNextInt32()));
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_packing_growable(new char[4], 4);
+        ser& strings_in;
+
+        char*  buffer = ser.packer().buffer();
+        size_t size   = ser.size();
+
+        std::vector<std::string> strings_out;
+        ser.start_unpacking(buffer, size);
+        ser& strings_out;
+        delete[] buffer;
+
+        if ( strings_in != strings_out )
+            out.output("ERROR: packing into a growable buffer did not serialize/deserialize properly\n");
+    }
+
+    {
+        // Structs marked trivially serializable and vectors of them
+        // are copied in bulk
+        NetworkPayload net_in = { rng->generateNextUInt64(), rng->generateNextUInt64(), rng->generateNextUInt64(),
+                                  rng->generateNextUInt64(), rng->generateNextUInt32(), rng->generateNextUInt32() };
+
+        passed = checkSimpleSerializeDeserialize(net_in);
+        if ( !passed ) out.output("ERROR: trivially serializable struct did not serialize/deserialize properly\n");
+
+        std::vector<NetworkPayload> net_vector_in(10, net_in);
+        passed = checkContainerSerializeDeserialize(net_vector_in);
+        if ( !passed )
+            out.output("ERROR: vector of trivially serializable struct did not serialize/deserialize properly\n");
+    }
+
+    {
+        // The model gives this component its params as a shared set.
+        // Params that share the set write it only the first time it is
+        // used in a message, and unpack to a single shared set.
+        auto packParams = [](const std::vector<Params*>& list) -> std::vector<char> {
+            SST::Core::Serialization::serializer ser;
+            ser.start_sizing();
+            for ( auto p : list )
+                ser& *p;
+            std::vector<char> buffer(ser.size());
+            ser.start_packing(buffer.data(), buffer.size());
+            for ( auto p : list )
+                ser& *p;
+            return buffer;
+        };
+
+        Params params_in[2];
+        for ( auto& p : params_in ) {
+            p.enableVerify(false);
+            p.insert(params);
+        }
+        // Local values override the shared set
+        params_in[0].insert("shared.first", "10");
+        params_in[1].insert("shared.second", "20");
+
+        std::vector<char> buffer = packParams({ &params_in[0], &params_in[1] });
+        passed = buffer.size() < packParams({ &params_in[0] }).size() + packParams({ &params_in[1] }).size();
+
+        Params                               params_out[2];
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(buffer.data(), buffer.size());
+        for ( auto& p : params_out ) {
+            ser& p;
+            p.enableVerify(false);
+        }
+
+        // Packing the unpacked objects again only writes the set once
+        // if they share one set
+        passed = passed && packParams({ &params_out[0], &params_out[1] }).size() == buffer.size();
+
+        Params scoped[2] = { params_out[0].get_scoped_params("shared"), params_out[1].get_scoped_params("shared") };
+        scoped[0].enableVerify(false);
+        scoped[1].enableVerify(false);
+        passed = passed && params_out[0].find<int>("shared.first") == 10 &&
+                 params_out[0].find<int>("shared.second") == 2 && params_out[1].find<int>("shared.first") == 1 &&
+                 params_out[1].find<int>("shared.second") == 20 && scoped[0].find<int>("first") == 10 &&
+                 scoped[0].find<int>("second") == 2 && scoped[1].find<int>("first") == 1 &&
+                 scoped[1].find<int>("second") == 20;
+        if ( !passed ) out.output("ERROR: Params with a shared set did not serialize/deserialize properly\n");
+    }
+
+    uint64_t benchmark = params.find<uint64_t>("benchmark", 0);
+    if ( benchmark > 0 ) {
+        runEventBenchmark<BenchmarkNetworkEvent>(out, "network_fields", benchmark, rng);
+        runEventBenchmark<BenchmarkNetworkEventBulk>(out, "network_bulk", benchmark, rng);
+        runEventBenchmark<BenchmarkMemoryEvent>(out, "memory_fields", benchmark, rng);
+        runEventBenchmark<BenchmarkMemoryEventBulk>(out, "memory_bulk", benchmark, rng);
+    }
 }
 
 
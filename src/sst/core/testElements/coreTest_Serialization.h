@@ -36,6 +36,9 @@ public:
     )
 
     SST_ELI_DOCUMENT_PARAMS(
+        { "benchmark", "Number of events to use for the event serialization benchmark.  0 skips the benchmark.", "0" },
+        { "shared.first", "Value for the shared params serialization test", "1" },
+        { "shared.second", "Value for the shared params serialization test", "2" }
     )
 
     // Optional since there is nothing to document
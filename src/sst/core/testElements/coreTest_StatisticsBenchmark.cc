@@ -0,0 +1,73 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_StatisticsBenchmark.h"
+
+#include "sst/core/rng/marsaglia.h"
+
+#include <chrono>
+
+namespace SST {
+namespace CoreTestStatisticsBenchmark {
+
+coreTestStatisticsBenchmark::coreTestStatisticsBenchmark(ComponentId_t id, Params& params) : Component(id)
+{
+    values   = params.find<uint64_t>("values", 10000000);
+    maxvalue = params.find<uint64_t>("maxvalue", 1000000);
+    seed     = params.find<uint32_t>("seed", 7);
+    if ( maxvalue == 0 ) maxvalue = 1;
+
+    stat_a = registerStatistic<uint64_t>("stat_a");
+    stat_b = registerStatistic<uint64_t>("stat_b");
+}
+
+coreTestStatisticsBenchmark::coreTestStatisticsBenchmark() : Component(-1)
+{
+    // for serialization only
+}
+
+void
+coreTestStatisticsBenchmark::setup()
+{
+    // Generate the values up front so only the statistic is timed
+    SST::RNG::MarsagliaRNG rng(seed, 362436069);
+    std::vector<uint64_t>  data(values);
+    for ( auto& value : data ) {
+        value = rng.generateNextUInt64() % maxvalue;
+    }
+
+    runBenchmark(stat_a, data);
+    runBenchmark(stat_b, data);
+}
+
+void
+coreTestStatisticsBenchmark::runBenchmark(Statistic<uint64_t>* stat, const std::vector<uint64_t>& data)
+{
+    auto start = std::chrono::steady_clock::now();
+    for ( auto value : data ) {
+        stat->addData(value);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double time = std::chrono::duration<double>(end - start).count();
+    getSimulationOutput().output(
+        "%s (%s): %" PRIu64 " values, %.3f Mvalues/s\n", stat->getStatName().c_str(),
+        stat->getStatTypeName().c_str(), (uint64_t)data.size(), time > 0 ? data.size() / time / 1e6 : 0.0);
+}
+
+} // namespace CoreTestStatisticsBenchmark
+} // namespace SST
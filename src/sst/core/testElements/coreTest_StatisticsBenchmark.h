@@ -0,0 +1,87 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_STATISTICSBENCHMARK_H
+#define SST_CORE_CORETEST_STATISTICSBENCHMARK_H
+
+#include "sst/core/component.h"
+
+#include <vector>
+
+namespace SST {
+namespace CoreTestStatisticsBenchmark {
+
+/**
+ * Microbenchmark for statistic types.  Adds the same random values to
+ * each of its statistics during setup and reports the throughput of
+ * each.  The input file picks the statistic type for each one, so two
+ * implementations of the same statistic (for example
+ * sst.HistogramStatistic and sst.FixedHistogramStatistic) can be
+ * timed and their output compared.
+ */
+class coreTestStatisticsBenchmark : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestStatisticsBenchmark,
+        "coreTestElement",
+        "coreTestStatisticsBenchmark",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Statistics Benchmark Component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "values",   "Number of values to add to each statistic", "10000000" },
+        { "maxvalue", "Values are drawn uniformly from [0, maxvalue)", "1000000" },
+        { "seed",     "Seed for the random number generator", "7" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "stat_a", "First statistic to benchmark", "units", 1},
+        { "stat_b", "Second statistic to benchmark", "units", 1}
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestStatisticsBenchmark(SST::ComponentId_t id, SST::Params& params);
+    void setup();
+    void finish() {}
+
+private:
+    coreTestStatisticsBenchmark();                                   // for serialization only
+    coreTestStatisticsBenchmark(const coreTestStatisticsBenchmark&); // do not implement
+    void operator=(const coreTestStatisticsBenchmark&);              // do not implement
+
+    void runBenchmark(Statistic<uint64_t>* stat, const std::vector<uint64_t>& data);
+
+    uint64_t             values;
+    uint64_t             maxvalue;
+    uint32_t             seed;
+    Statistic<uint64_t>* stat_a;
+    Statistic<uint64_t>* stat_b;
+};
+
+} // namespace CoreTestStatisticsBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_STATISTICSBENCHMARK_H
@@ -0,0 +1,130 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_TimeVortexBenchmark.h"
+
+#include "sst/core/factory.h"
+#include "sst/core/rng/marsaglia.h"
+#include "sst/core/timeVortex.h"
+
+#include <chrono>
+
+namespace SST {
+namespace CoreTestTimeVortexBenchmark {
+
+// Activity that does nothing, used only to fill the TimeVortex
+class BenchmarkActivity : public Activity
+{
+public:
+    BenchmarkActivity(SimTime_t time, uint32_t priority) : Activity()
+    {
+        setDeliveryTime(time);
+        setPriority(priority);
+    }
+
+    void execute() override {}
+
+    NotSerializable(SST::CoreTestTimeVortexBenchmark::BenchmarkActivity)
+};
+
+coreTestTimeVortexBenchmark::coreTestTimeVortexBenchmark(ComponentId_t id, Params& params) : Component(id)
+{
+    timevortex = params.find<std::string>("timevortex", "sst.timevortex.priority_queue");
+    operations = params.find<uint64_t>("operations", 1000000);
+    priorities = params.find<uint32_t>("priorities", 4);
+    seed       = params.find<uint32_t>("seed", 7);
+    params.find_array<uint64_t>("sizes", sizes);
+    if ( sizes.empty() ) sizes = { 1000, 10000, 100000 };
+    if ( priorities == 0 ) priorities = 1;
+}
+
+coreTestTimeVortexBenchmark::coreTestTimeVortexBenchmark() : Component(-1)
+{
+    // for serialization only
+}
+
+void
+coreTestTimeVortexBenchmark::setup()
+{
+    for ( auto size : sizes ) {
+        runBenchmark(size);
+    }
+}
+
+void
+coreTestTimeVortexBenchmark::runBenchmark(uint64_t size)
+{
+    Output& out = getSimulationOutput();
+    Params  params;
+
+    TimeVortex* tv = Factory::getFactory()->Create<TimeVortex>(timevortex, params);
+    if ( nullptr == tv ) out.fatal(CALL_INFO, 1, "Unable to create TimeVortex %s\n", timevortex.c_str());
+
+    SST::RNG::MarsagliaRNG rng(seed, 362436069);
+
+    // Delivery times are spread over a window the size of the queue
+    // so there is roughly one activity per time
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < size; ++i ) {
+        tv->insert(new BenchmarkActivity(rng.generateNextUInt64() % size, rng.generateNextUInt32() % priorities));
+    }
+    auto fill_end = std::chrono::steady_clock::now();
+
+    // Every activity popped must sort after the one before it
+    SimTime_t prev_time     = 0;
+    int       prev_priority = 0;
+
+    auto checkOrder = [&](Activity* act) {
+        SimTime_t time = act->getDeliveryTime();
+        if ( time < prev_time || (time == prev_time && act->getPriority() < prev_priority) ) {
+            out.fatal(
+                CALL_INFO, 1, "%s returned activities out of order at depth %" PRIu64 "\n", timevortex.c_str(), size);
+        }
+        prev_time     = time;
+        prev_priority = act->getPriority();
+    };
+
+    // Hold model: pop the next activity and reinsert it in the
+    // future, which keeps the queue depth constant
+    for ( uint64_t i = 0; i < operations; ++i ) {
+        Activity* act = tv->pop();
+        checkOrder(act);
+        act->setDeliveryTime(act->getDeliveryTime() + 1 + rng.generateNextUInt64() % size);
+        tv->insert(act);
+    }
+    auto hold_end = std::chrono::steady_clock::now();
+
+    while ( !tv->empty() ) {
+        Activity* act = tv->pop();
+        checkOrder(act);
+        delete act;
+    }
+    auto drain_end = std::chrono::steady_clock::now();
+
+    delete tv;
+
+    double fill_time  = std::chrono::duration<double>(fill_end - start).count();
+    double hold_time  = std::chrono::duration<double>(hold_end - fill_end).count();
+    double drain_time = std::chrono::duration<double>(drain_end - hold_end).count();
+    out.output(
+        "%s: depth %" PRIu64 ": insert %.3f Mops/s, hold %.3f Mops/s, pop %.3f Mops/s\n", timevortex.c_str(), size,
+        fill_time > 0 ? size / fill_time / 1e6 : 0.0, hold_time > 0 ? operations / hold_time / 1e6 : 0.0,
+        drain_time > 0 ? size / drain_time / 1e6 : 0.0);
+}
+
+} // namespace CoreTestTimeVortexBenchmark
+} // namespace SST
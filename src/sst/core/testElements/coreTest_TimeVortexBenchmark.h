@@ -0,0 +1,87 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
+#define SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
+
+#include "sst/core/component.h"
+
+#include <vector>
+
+namespace SST {
+namespace CoreTestTimeVortexBenchmark {
+
+/**
+ * Microbenchmark for TimeVortex implementations.  For each requested
+ * queue depth, fills a TimeVortex with activities, runs a number of
+ * hold operations (pop followed by an insert in the future) and then
+ * drains it, reporting the throughput of each phase and checking
+ * that activities come out in order.
+ */
+class coreTestTimeVortexBenchmark : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestTimeVortexBenchmark,
+        "coreTestElement",
+        "coreTestTimeVortexBenchmark",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex Benchmark Component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "timevortex", "TimeVortex to benchmark", "sst.timevortex.priority_queue" },
+        { "sizes",      "Array of queue depths to benchmark", "[1000, 10000, 100000]" },
+        { "operations", "Number of hold operations to run at each queue depth", "1000000" },
+        { "priorities", "Number of distinct priorities to give activities", "4" },
+        { "seed",       "Seed for the random number generator", "7" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestTimeVortexBenchmark(SST::ComponentId_t id, SST::Params& params);
+    void setup();
+    void finish() {}
+
+private:
+    coreTestTimeVortexBenchmark();                                   // for serialization only
+    coreTestTimeVortexBenchmark(const coreTestTimeVortexBenchmark&); // do not implement
+    void operator=(const coreTestTimeVortexBenchmark&);              // do not implement
+
+    void runBenchmark(uint64_t size);
+
+    std::string           timevortex;
+    std::vector<uint64_t> sizes;
+    uint64_t              operations;
+    uint32_t              priorities;
+    uint32_t              seed;
+};
+
+} // namespace CoreTestTimeVortexBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
@@ -68,7 +68,16 @@ public:
      * Wait for all threads to reach this point.
      * @return 0.0, or elapsed time spent waiting, if configured with --enable-profile
      */
-    double wait()
+    double wait() { return wait([]() { return false; }); }
+
+    /**
+     * Wait for all threads to reach this point, calling idle() while
+     * waiting for the other threads.  idle() returns true if it did
+     * any work, which restarts the spin before backing off.
+     * @return 0.0, or elapsed time spent waiting, if configured with --enable-profile
+     */
+    template <typename F>
+    double wait(F&& idle)
     {
         double elapsed = 0.0;
         if ( enabled ) {
@@ -90,7 +99,10 @@ public:
                 uint32_t count = 0;
                 do {
                     count++;
-                    if ( count < 1024 ) { sst_pause(); }
+                    if ( idle() ) { count = 0; }
+                    else if ( count < 1024 ) {
+                        sst_pause();
+                    }
                     else if ( count < (1024 * 1024) ) {
                         std::this_thread::yield();
                     }
@@ -0,0 +1,21 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Several components sharing clocks, with handlers finishing at
+# different cycles, so handlers are removed from the middle of the
+# clock lists
+for i in range(4):
+    comp = sst.Component("clocker%d"%i, "coreTestElement.coreTestClockerComponent")
+    comp.addParams({
+        "clock" : "5ns",
+        "clockcount" : 20 + 10 * i
+    })
@@ -0,0 +1,38 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Usage: sst -v --run-mode=init test_ConfigGraphMemory.py --model-options="<components> <link>"
+#
+# Builds a row of identical components, connected in a ring when <link>
+# is 1, so the graph memory reported by "sst -v" can be divided between
+# components and links.  Running with and without the links separates
+# the two; the testsuite uses 20000 components, and 10^6 or more shows
+# the cost at scale.
+num_comps = int(sys.argv[1])
+use_links = int(sys.argv[2]) != 0
+
+params = {
+    "link_time_base" : "1ns",
+}
+
+comps = []
+for i in range(num_comps):
+    comp = sst.Component("c%d" % i, "coreTestElement.coreTestLinks")
+    comp.addParams(params)
+    comp.addParam("id", i)
+    comps.append(comp)
+
+if use_links:
+    for i in range(num_comps):
+        link = sst.Link("link_%d" % i)
+        link.connect((comps[i], "Elink", "1ns"), (comps[(i + 1) % num_comps], "Wlink", "1ns"))
@@ -0,0 +1,33 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Pairs of components bouncing messages back and forth.  Their clock
+# handlers sleep while waiting for the next message, the second pair
+# also wakes up every 7 cycles to check
+for pair, sleep_cycles in enumerate([0, 7]):
+    comp0 = sst.Component("idle%d_0"%pair, "coreTestElement.coreTestIdleClockComponent")
+    comp0.addParams({
+        "id" : 2 * pair,
+        "initiator" : True,
+        "num_messages" : 5,
+        "sleep_cycles" : sleep_cycles
+    })
+
+    comp1 = sst.Component("idle%d_1"%pair, "coreTestElement.coreTestIdleClockComponent")
+    comp1.addParams({
+        "id" : 2 * pair + 1,
+        "num_messages" : 5,
+        "sleep_cycles" : sleep_cycles
+    })
+
+    link = sst.Link("link%d"%pair)
+    link.connect( (comp0, "port", "10ns"), (comp1, "port", "10ns") )
@@ -14,3 +14,12 @@ import sys
 sst.setProgramOption("stop-at", "1us");
 
 comp = sst.Component("Component0", "coreTestElement.coreTestSerialization")
+
+# Checked by the shared params test, which needs params that the model
+# stores as a shared set
+comp.addParams({ "shared.first" : "1", "shared.second" : "2" })
+
+# Optional argument is the number of events to use for the event
+# serialization benchmark
+if len(sys.argv) > 1:
+    comp.addParams({ "benchmark" : sys.argv[1] })
@@ -0,0 +1,42 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Usage: sst test_StatisticsBenchmark.py --model-options="<type a> <type b> <csv file> [log2]"
+#
+# Adds the same values to a statistic of each type and writes both
+# to the CSV file at the end of the run.  With log2 the histograms use
+# log2 bins.
+sst.setProgramOption("stopAtCycle", "1ns")
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputCSV", { "filepath" : sys.argv[3] })
+
+comp = sst.Component("benchmark", "coreTestElement.coreTestStatisticsBenchmark")
+comp.addParams({
+      "values" : "10000000",
+      "maxvalue" : "1100000",
+      "seed" : "7"
+})
+
+# Some values fall above the last bin to exercise the out of bounds count
+params = {
+    "rate" : "0ns",
+    "minvalue" : "0",
+    "binwidth" : "1000",
+    "numbins" : "1000"
+}
+if len(sys.argv) > 4 and sys.argv[4] == "log2":
+    params["log2bins"] = "true"
+    params["numbins"] = "20"
+
+comp.enableStatistics(["stat_a"], dict(params, type=sys.argv[1]))
+comp.enableStatistics(["stat_b"], dict(params, type=sys.argv[2]))
@@ -0,0 +1,77 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# This script writes the same statistics with either
+# sst.statOutputCSV or sst.statOutputBinary so the converted binary
+# file can be compared to the CSV file.
+#
+# Arguments: <csv|binary> <output file path>
+#
+# The statistics cover every field type, periodic and event based
+# output, a histogram, and statistics that only output some of the
+# columns.
+########################################################################
+
+outputs = {
+    "csv" : "sst.statOutputCSV",
+    "binary" : "sst.statOutputBinary"
+}
+
+sst.setStatisticLoadLevel(7)
+
+# A small block size so the binary file has many blocks
+params = { "filepath" : sys.argv[2] }
+if sys.argv[1] == "binary":
+    params["blockrows"] = 5
+sst.setStatisticOutput(outputs[sys.argv[1]], params)
+
+IntComp = sst.Component("IntComp", "coreTestElement.StatisticsComponent.int")
+IntComp.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+})
+
+IntComp.enableStatistics(["stat1_U32", "stat3_I32"], {
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "5 ns"})
+
+IntComp.enableStatistics(["stat2_U64"], {
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "10 ns",
+    "resetOnOutput" : True})
+
+IntComp.enableStatistics(["stat4_I64"], {
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "7 events"})
+
+IntComp.enableStatistics(["stat5_U32"], {
+    "type" : "sst.HistogramStatistic",
+    "rate" : "20 ns",
+    "minvalue" : "0",
+    "binwidth" : "100",
+    "numbins" : "10"})
+
+FloatComp = sst.Component("FloatComp", "coreTestElement.StatisticsComponent.float")
+FloatComp.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1448",
+      "seed_z" : "1054"
+})
+
+FloatComp.enableStatistics(["stat1_F32", "stat2_F64"], {
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "8 ns"})
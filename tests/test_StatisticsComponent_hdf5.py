@@ -0,0 +1,44 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# This script writes a statistic group to an HDF5 file in collective
+# mode, where every rank writes its own components into one shared
+# file.
+#
+# Arguments: <h5 file path>
+########################################################################
+
+sst.setStatisticLoadLevel(7)
+
+output = sst.StatisticOutput("sst.statOutputHDF5", { "filepath" : sys.argv[1],
+                                                     "collective" : "1" })
+
+group = sst.StatisticGroup("collective")
+group.setOutput(output)
+group.addStatistic("stat1_U32", { "type" : "sst.AccumulatorStatistic" })
+group.addStatistic("stat3_I32", { "type" : "sst.HistogramStatistic",
+                                  "minvalue" : "-250",
+                                  "binwidth" : "50",
+                                  "numbins" : "10" })
+group.setFrequency("25 ns")
+
+for i in range(6):
+    comp = sst.Component("IntComp{0}".format(i), "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+          "rng" : "marsaglia",
+          "count" : "100",
+          "seed_w" : str(1447 + i),
+          "seed_z" : str(1053 + i)
+    })
+    group.addComponent(comp)
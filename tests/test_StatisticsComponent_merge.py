@@ -0,0 +1,62 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# This script writes the statistics of several components either for
+# each component or merged through a statistic group, so the merged
+# values can be checked against the per-component ones.
+#
+# Arguments: <separate|merged> <csv file path>
+########################################################################
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputCSV", { "filepath" : sys.argv[2] })
+
+stats = {
+    "stat1_U32" : { "type" : "sst.AccumulatorStatistic" },
+    "stat2_U64" : { "type" : "sst.AccumulatorStatistic",
+                    "resetOnOutput" : True },
+    "stat3_I32" : { "type" : "sst.HistogramStatistic",
+                    "minvalue" : "-250",
+                    "binwidth" : "50",
+                    "numbins" : "10" },
+    "stat4_I64" : { "type" : "sst.FixedHistogramStatistic",
+                    "minvalue" : "-10000",
+                    "binwidth" : "2048",
+                    "numbins" : "10",
+                    "resetOnOutput" : True }
+}
+
+comps = []
+for i in range(6):
+    comp = sst.Component("IntComp{0}".format(i), "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+          "rng" : "marsaglia",
+          "count" : "100",
+          "seed_w" : str(1447 + i),
+          "seed_z" : str(1053 + i)
+    })
+    comps.append(comp)
+
+if sys.argv[1] == "merged":
+    group = sst.StatisticGroup("merged")
+    group.setMerge(True)
+    for name, params in stats.items():
+        group.addStatistic(name, params)
+    group.setFrequency("25 ns")
+    for comp in comps:
+        group.addComponent(comp)
+else:
+    for comp in comps:
+        for name, params in stats.items():
+            comp.enableStatistics([name], dict(params, rate="25 ns"))
@@ -0,0 +1,58 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# This script adds random values to an exact histogram and to a sketch
+# statistic on each of several components, and merges each statistic
+# across the components, threads and ranks.  The "quantiles" group
+# pairs the histogram with a QuantileSketch and the "unique" group
+# pairs it with a HyperLogLog, so the estimates can be checked against
+# the exact values.
+#
+# Arguments: <csv file path>
+########################################################################
+
+sst.setProgramOption("stopAtCycle", "1ns")
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputCSV", { "filepath" : sys.argv[1] })
+
+maxvalue = 20000
+
+# One bin per value, so the histogram has the exact distribution
+exact = {
+    "type" : "sst.FixedHistogramStatistic",
+    "minvalue" : "0",
+    "binwidth" : "1",
+    "numbins" : str(maxvalue)
+}
+sketches = {
+    "quantiles" : { "type" : "sst.QuantileSketchStatistic",
+                    "accuracy" : "0.01",
+                    "percentiles" : "[0, 25, 50, 90, 99, 99.9, 100]" },
+    "unique" : { "type" : "sst.HyperLogLogStatistic",
+                 "precision" : "12" }
+}
+
+for name, sketch in sketches.items():
+    group = sst.StatisticGroup(name)
+    group.setMerge(True)
+    group.addStatistic("stat_a", exact)
+    group.addStatistic("stat_b", sketch)
+    for i in range(4):
+        comp = sst.Component("{0}{1}".format(name, i), "coreTestElement.coreTestStatisticsBenchmark")
+        comp.addParams({
+              "values" : "20000",
+              "maxvalue" : str(maxvalue),
+              "seed" : str(11 + i)
+        })
+        group.addComponent(comp)
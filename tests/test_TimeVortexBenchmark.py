@@ -0,0 +1,34 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Usage: sst test_TimeVortexBenchmark.py --model-options="<timevortex> [size ...]"
+#
+# Sizes are the queue depths to benchmark.  To reproduce the full
+# sweep use: 1000 10000 100000 1000000 10000000 100000000
+timevortex = "sst.timevortex.priority_queue"
+sizes = [1000, 10000, 100000]
+if len(sys.argv) > 1:
+    timevortex = sys.argv[1]
+if len(sys.argv) > 2:
+    sizes = [int(x) for x in sys.argv[2:]]
+
+# Define SST core options
+sst.setProgramOption("stopAtCycle", "1ns")
+
+# Define the simulation components
+comp = sst.Component("benchmark", "coreTestElement.coreTestTimeVortexBenchmark")
+comp.addParams({
+      "timevortex" : timevortex,
+      "sizes" : sizes,
+      "operations" : "1000000"
+})
@@ -0,0 +1,116 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_Clock(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_Clock_handlers(self):
+        self.clock_test_template("handlers", "")
+
+    def test_Clock_handlers_grouped(self):
+        self.clock_test_template("handlers_grouped", "", "--group-clock-handlers")
+
+    def test_Clock_profile_count(self):
+        self.clock_test_template("profile_count", "sst.profile.handler.clock.count")
+
+    def test_Clock_profile_time(self):
+        self.clock_test_template("profile_time", "sst.profile.handler.clock.time.steady")
+
+    def test_Clock_idle(self):
+        self.idle_clock_test_template("idle")
+
+    def test_Clock_idle_threads(self):
+        self.idle_clock_test_template("idle_threads", num_threads=2)
+
+#####
+
+    def clock_test_template(self, testtype, profiler, extra_args=""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_ClockHandlers.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_ClockHandlers.out".format(testsuitedir)
+        outfile = "{0}/test_Clock_{1}.out".format(outdir, testtype)
+        profile_file = "{0}/test_Clock_{1}_profile.out".format(outdir, testtype)
+
+        options = extra_args
+        if profiler != "":
+            options += " --enable-profiling=\"clock:{0}(level=global)\" --profiling-output={1}".format(profiler, profile_file)
+
+        self.run_sst(sdlfile, outfile, other_args=options)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+        if profiler == "":
+            return
+
+        # Check that the per clock statistics for the 5ns and 15ns
+        # clocks (periods are in core time units) are there
+        with open(profile_file, 'r') as f:
+            lines = f.readlines()
+        clock_lines = [line for line in lines if line.startswith("5000, ") or line.startswith("15000, ")]
+        self.assertTrue(any(line.startswith("Clock period, priority, ticks") for line in lines),
+                        "Profile output {0} is missing the per clock statistics".format(profile_file))
+        self.assertTrue(len(clock_lines) >= 2, "Profile output {0} is missing clock entries".format(profile_file))
+
+    def idle_clock_test_template(self, testtype, num_threads=1):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_IdleClock.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_IdleClock.out".format(testsuitedir)
+        outfile = "{0}/test_Clock_{1}.out".format(outdir, testtype)
+
+        self.run_sst(sdlfile, outfile, num_ranks=1, num_threads=num_threads)
+
+        # Output includes the number of clock ticks each component saw,
+        # which only matches if the sleeping handlers were skipped
+        cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+have_mempool = sst_core_config_include_file_get_value_int("USE_MEMPOOL", default=0, disable_warning=True) > 0
+
+class testcase_MemPool(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+    mempoolerr = "Test requires SST to be configured with mempools enabled"
+
+    @unittest.skipIf(not have_mempool, mempoolerr)
+    def test_MemPool_trim(self):
+        self.mempool_test_template("trim", "--mempool-trim-period=100ns")
+
+    @unittest.skipIf(not have_mempool, mempoolerr)
+    def test_MemPool_trim_threads(self):
+        self.mempool_test_template("trim_threads", "--mempool-trim-period=100ns", num_threads=2)
+
+    @unittest.skipIf(not have_mempool, mempoolerr)
+    def test_MemPool_huge_pages_transparent(self):
+        self.mempool_test_template("huge_pages_transparent", "--mempool-huge-pages=transparent")
+
+    @unittest.skipIf(not have_mempool, mempoolerr)
+    def test_MemPool_huge_pages_explicit(self):
+        self.mempool_test_template("huge_pages_explicit", "--mempool-huge-pages=explicit --mempool-trim-period=1us")
+
+#####
+
+    def mempool_test_template(self, testtype, mempool_options, num_threads=1):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_ref = "{0}/test_MemPool_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_MemPool_check_{1}.out".format(outdir, testtype)
+        undeleted_file = "{0}/test_MemPool_undeleted_{1}.out".format(outdir, testtype)
+
+        ref_options = "--model-options=\"8 8\""
+        options = "--model-options=\"8 8\" {0} --output-undeleted-events={1}".format(mempool_options, undeleted_file)
+
+        # Trimming and huge pages only change where activities live,
+        # so the output has to match a run without them
+        self.run_sst(sdlfile, outfile_ref, other_args=ref_options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=options, num_ranks=1, num_threads=num_threads)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_check, outfile_ref)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
+
+        # The undeleted events dump starts with the resident/reserved
+        # breakdown for the rank
+        with open(undeleted_file, 'r') as f:
+            lines = [line for line in f if line.startswith("Mempool usage on rank 0:")]
+        self.assertEqual(len(lines), 1, "Undeleted events file {0} is missing the mempool usage".format(undeleted_file))
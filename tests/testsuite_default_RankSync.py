@@ -0,0 +1,121 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+have_libz = sst_core_config_include_file_get_value_int("HAVE_LIBZ", default=0, disable_warning=True) > 0
+libzerr = "RankSync compression tests require SST to be built with zlib"
+
+class testcase_RankSync(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_RankSync_serial(self):
+        self.rank_sync_test_template("serial")
+
+    def test_RankSync_parallel(self):
+        self.rank_sync_test_template("parallel")
+
+    def test_RankSync_parallel_threads(self):
+        self.rank_sync_test_template("parallel", num_threads=2)
+
+    def test_RankSync_persistent(self):
+        self.rank_sync_test_template("persistent")
+
+    def test_RankSync_adaptive_lookahead(self):
+        self.rank_sync_test_template("auto", adaptive_lookahead=True)
+
+    def test_RankSync_adaptive_lookahead_threads(self):
+        self.rank_sync_test_template("auto", num_threads=2, adaptive_lookahead=True)
+
+    # A small threshold so most of the sync buffers get compressed
+    @unittest.skipIf(not have_libz, libzerr)
+    def test_RankSync_compression(self):
+        self.rank_sync_test_template("serial", compression=64)
+
+    @unittest.skipIf(not have_libz, libzerr)
+    def test_RankSync_compression_persistent(self):
+        self.rank_sync_test_template("persistent", compression=64)
+
+    @unittest.skipIf(not have_libz, libzerr)
+    def test_RankSync_compression_threads(self):
+        self.rank_sync_test_template("parallel", num_threads=2, compression=64)
+
+#####
+
+    def rank_sync_test_template(self, testtype, num_threads=None, adaptive_lookahead=False, compression=None):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        testname = testtype
+        if adaptive_lookahead:
+            testname = "{0}_adaptive".format(testname)
+        if compression:
+            testname = "{0}_compressed".format(testname)
+        if num_threads:
+            testname = "{0}_{1}threads".format(testname, num_threads)
+
+        outfile_ref = "{0}/test_RankSync_ref_{1}.out".format(outdir, testname)
+        outfile_check = "{0}/test_RankSync_check_{1}.out".format(outdir, testname)
+
+        ref_options = "--model-options=\"8 8\""
+        options = "--model-options=\"8 8\" --rank-sync={0}".format(testtype)
+        if adaptive_lookahead:
+            options += " --adaptive-lookahead"
+        if compression:
+            options += " --rank-sync-compression={0}".format(compression)
+
+        # The rank sync only changes how events get between ranks, so
+        # the output has to match a serial run.
+        self.run_sst(sdlfile, outfile_ref, other_args=ref_options, num_ranks=1, num_threads=1)
+        # The check run uses however many ranks the tests are being run
+        # with.  With multiple threads, each thread deserializes the
+        # events for its own links.
+        self.run_sst(sdlfile, outfile_check, other_args=options, num_threads=num_threads)
+
+        cmp_result = testing_compare_sorted_diff(testname, outfile_check, outfile_ref)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
@@ -68,3 +68,25 @@ class testcase_StatisticComponent(SSTTestCase):
         filter1 = StartsWithFilter("WARNING: No components are")
         cmp_result = testing_compare_filtered_diff("serialization", outfile, reffile, True, [filter1])
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_Serialization_benchmark(self):
+
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Serialization.py".format(testsuitedir)
+        outfile = "{0}/test_Serialization_benchmark.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args="--model-options=\"100000\"", num_ranks=1, num_threads=1)
+
+        # The component checks every event it unpacks, so make sure
+        # there were no errors and every event type reported its
+        # throughput
+        with open(outfile, 'r') as f:
+            lines = f.readlines()
+        errors = [line.strip() for line in lines if line.startswith("ERROR")]
+        results = [line.strip() for line in lines if line.startswith("benchmark ")]
+        for line in results:
+            log_info(line, forced=False)
+        self.assertEqual(len(errors), 0, "Benchmark output {0} has errors".format(outfile))
+        self.assertEqual(len(results), 4, "Benchmark output {0} is missing results".format(outfile))
@@ -17,6 +17,8 @@ import filecmp
 from sst_unittest import *
 from sst_unittest_support import *
 
+have_hdf5 = sst_core_config_include_file_get_value_int("HAVE_HDF5", default=0, disable_warning=True) > 0
+
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
 
@@ -56,17 +58,271 @@ class testcase_StatisticComponent(SSTTestCase):
     def test_StatisticsBasic(self):
         self.Statistics_test_template("basic")
 
+    # Small queue so the simulation has to wait on the writer thread
+    def test_StatisticsBasic_async(self):
+        self.Statistics_test_template("basic", async_output=True)
+
+    def test_StatisticsBinary(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_binary.py".format(testsuitedir)
+        csvfile = "{0}/test_StatisticsComponent_binary.csv".format(outdir)
+        binfile = "{0}/test_StatisticsComponent_binary.sstb".format(outdir)
+        convfile = "{0}/test_StatisticsComponent_binary_converted.csv".format(outdir)
+
+        # Write the same statistics as CSV and as binary
+        self.run_sst(sdlfile, "{0}/test_StatisticsComponent_binary_csv.out".format(outdir),
+                     other_args="--model-options=\"csv {0}\"".format(csvfile))
+        self.run_sst(sdlfile, "{0}/test_StatisticsComponent_binary_bin.out".format(outdir),
+                     other_args="--model-options=\"binary {0}\"".format(binfile))
+
+        # Converting the binary file should give back the CSV file
+        sst_app_path = sstsimulator_conf_get_value_str('SSTCore', 'bindir', default="UNDEFINED")
+        cmd = '{0}/sst-stat-convert {1} {2}'.format(sst_app_path, binfile, convfile)
+        rtn = OSCommand(cmd).run()
+        self.assertEqual(rtn.result(), 0, "sst-stat-convert failed running cmdline {0} - return = {1}".format(cmd, rtn.result()))
+
+        self.assertTrue(filecmp.cmp(csvfile, convfile, shallow=False),
+                        "Converted file {0} does not match CSV File {1}".format(convfile, csvfile))
+
+    def test_StatisticsBenchmark_histogram(self):
+        rows = self.benchmark_test_template("histogram", "sst.HistogramStatistic", "sst.FixedHistogramStatistic")
+
+        # Everything but the statistic name and type must match
+        self.assertEqual(rows[0][4:], rows[1][4:], "Histogram outputs differ: {0}".format(rows))
+
+    def test_StatisticsBenchmark_log2histogram(self):
+        rows = self.benchmark_test_template("log2histogram", "sst.FixedHistogramStatistic",
+                                            "sst.FixedHistogramStatistic", "log2")
+
+        # The bins and out of bounds counts must account for every value
+        header, row = rows[-1], rows[0]
+        values = dict(zip(header, row))
+        collected = int(values["NumItemsCollected.u64"])
+        binned = int(values["NumItemsBinned.u64"])
+        oob = int(values["NumOutOfBounds-MinValue.u64"]) + int(values["NumOutOfBounds-MaxValue.u64"])
+        bins = sum(int(v) for k, v in values.items() if k.startswith("Bin") and not k.startswith("BinWidth")
+                   and not k.startswith("BinsM"))
+        self.assertEqual(collected, binned + oob, "log2 histogram lost values: {0}".format(values))
+        self.assertEqual(binned, bins, "log2 histogram bins don't add up: {0}".format(values))
+        self.assertEqual(rows[0][4:], rows[1][4:], "log2 histogram outputs differ: {0}".format(rows))
+
+    def test_StatisticsMerge(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_merge.py".format(testsuitedir)
+        sepfile = "{0}/test_StatisticsComponent_merge_separate.csv".format(outdir)
+
+        # Threaded runs skip the periodic output at the end time (the
+        # end of simulation output covers it instead), so the reference
+        # run uses a single thread.
+        self.run_sst(sdlfile, "{0}/test_StatisticsComponent_merge_separate.out".format(outdir),
+                     other_args="--model-options=\"separate {0}\"".format(sepfile), num_ranks=1, num_threads=1)
+
+        # Rows are keyed by statistic and output number.  Each merged
+        # row must combine the matching row of every component.
+        def read_rows(filename):
+            with open(filename, 'r') as f:
+                lines = [[x.strip() for x in line.split(",")] for line in f]
+            header = lines[0]
+            rows = {}
+            for line in lines[1:]:
+                row = dict(zip(header, line))
+                rows.setdefault((row["ComponentName"], row["StatisticName"]), []).append(row)
+            return rows
+
+        separate = read_rows(sepfile)
+        stats = set(key[1] for key in separate)
+
+        # Merge on one thread and across two threads, where each thread
+        # has its own partial results
+        for threads in (1, 2):
+            mrgfile = "{0}/test_StatisticsComponent_merge_merged_{1}.csv".format(outdir, threads)
+            self.run_sst(sdlfile, "{0}/test_StatisticsComponent_merge_merged_{1}.out".format(outdir, threads),
+                         other_args="--model-options=\"merged {0}\"".format(mrgfile), num_ranks=1, num_threads=threads)
+
+            merged = read_rows(mrgfile)
+            self.assertEqual(set(key[0] for key in merged), {"merged"}, "Unexpected merged component names")
+            self.assertEqual(set(key[1] for key in merged), stats, "Merged statistics don't match")
+
+            for stat in stats:
+                comp_rows = [rows for key, rows in separate.items() if key[1] == stat]
+                merged_rows = merged[("merged", stat)]
+                self.assertTrue(len(merged_rows) >= 4, "Too few {0} outputs with {1} threads".format(stat, threads))
+                for rows in comp_rows:
+                    self.assertTrue(len(rows) >= len(merged_rows), "Too many {0} outputs with {1} threads".format(stat, threads))
+
+                for n, mrow in enumerate(merged_rows):
+                    crows = [rows[n] for rows in comp_rows]
+                    counted = [row for row in crows if int(row.get("Count.u64", "1")) > 0]
+                    bins = [k for k in mrow if k.startswith("Bin") and ":" in k]
+                    for field in mrow:
+                        name = field.split(".")[0]
+                        if name in ("ComponentName", "StatisticName", "StatisticSubId", "StatisticType", "Rank"):
+                            continue
+                        elif name in ("SimTime", "BinsMinValue", "BinsMaxValue", "BinWidth", "TotalNumBins"):
+                            expected = crows[0][field]
+                        elif name == "Min":
+                            expected = str(min(int(row[field]) for row in counted)) if counted else "0"
+                        elif name == "Max":
+                            expected = str(max(int(row[field]) for row in counted)) if counted else "0"
+                        elif name == "NumActiveBins":
+                            expected = str(len([k for k in bins if int(mrow[k]) > 0]))
+                        else:
+                            expected = str(sum(int(row[field]) for row in crows))
+                        self.assertEqual(mrow[field], expected,
+                                         "{0} threads, {1} output {2} field {3}: merged {4}, expected {5}".format(
+                                             threads, stat, n, field, mrow[field], expected))
+
+    def test_StatisticsSketch(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_sketch.py".format(testsuitedir)
+        csvfile = "{0}/test_StatisticsComponent_sketch.csv".format(outdir)
+
+        self.run_sst(sdlfile, "{0}/test_StatisticsComponent_sketch.out".format(outdir),
+                     other_args="--model-options=\"{0}\"".format(csvfile), num_threads=2)
+
+        # Each merged group is written once, by the lowest rank that has it
+        csvfiles = [csvfile]
+        if testing_check_get_num_ranks() > 1:
+            csvfiles = ["{0}/test_StatisticsComponent_sketch_{1}.csv".format(outdir, rank)
+                        for rank in range(testing_check_get_num_ranks())]
+
+        rows = {}
+        for name in csvfiles:
+            with open(name, 'r') as f:
+                lines = [[x.strip() for x in line.split(",")] for line in f]
+            for line in lines[1:]:
+                row = dict(zip(lines[0], line))
+                key = (row["ComponentName"], row["StatisticName"])
+                self.assertFalse(key in rows, "Merged statistic {0} was written more than once".format(key))
+                rows[key] = row
+
+        # Exact distribution from the one value per bin histograms
+        def get_bins(row):
+            bins = []
+            for field, value in row.items():
+                if field.startswith("Bin") and ":" in field and int(value) > 0:
+                    bins.append((int(field.split(":")[1].split("-")[0]), int(value)))
+            return sorted(bins)
+
+        # Percentiles must be within 1% of the exact ones
+        exact = rows[("quantiles", "stat_a")]
+        sketch = rows[("quantiles", "stat_b")]
+        bins = get_bins(exact)
+        count = int(exact["NumItemsCollected.u64"])
+        self.assertEqual(int(sketch["Count.u64"]), count, "Quantile sketch count is wrong")
+        self.assertEqual(int(sketch["Sum.u64"]), int(exact["Sum.u64"]), "Quantile sketch sum is wrong")
+        self.assertEqual(int(sketch["Min.u64"]), bins[0][0], "Quantile sketch min is wrong")
+        self.assertEqual(int(sketch["Max.u64"]), bins[-1][0], "Quantile sketch max is wrong")
+        for percentile in ["0", "25", "50", "90", "99", "99_9", "100"]:
+            rank = float(percentile.replace("_", ".")) / 100 * (count - 1)
+            seen = 0
+            for value, n in bins:
+                seen += n
+                if seen > rank:
+                    break
+            estimate = float(sketch["P{0}.f64".format(percentile)])
+            self.assertTrue(abs(estimate - value) <= 0.01 * value + 1e-9,
+                            "P{0}: estimate {1}, exact {2}".format(percentile, estimate, value))
+
+        # Unique estimate must be within 5% of the exact count
+        exact = rows[("unique", "stat_a")]
+        sketch = rows[("unique", "stat_b")]
+        unique = len(get_bins(exact))
+        estimate = int(sketch["UniqueItems.u64"])
+        self.assertEqual(int(sketch["Count.u64"]), int(exact["NumItemsCollected.u64"]), "HyperLogLog count is wrong")
+        self.assertTrue(abs(estimate - unique) <= 0.05 * unique,
+                        "Unique estimate {0}, exact {1}".format(estimate, unique))
+
+    @unittest.skipIf(not have_hdf5, "HDF5 statistic output is not built")
+    def test_StatisticsHDF5Collective(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_hdf5.py".format(testsuitedir)
+        h5file = "{0}/test_StatisticsComponent_hdf5.h5".format(outdir)
+        for name in [h5file] + ["{0}/test_StatisticsComponent_hdf5_{1}.h5".format(outdir, rank)
+                                for rank in range(testing_check_get_num_ranks())]:
+            if os.path.exists(name):
+                os.remove(name)
+
+        self.run_sst(sdlfile, "{0}/test_StatisticsComponent_hdf5.out".format(outdir),
+                     other_args="--model-options=\"{0}\"".format(h5file))
+
+        # Without parallel HDF5 each rank falls back to its own file
+        h5files = [h5file]
+        if not os.path.exists(h5file) and testing_check_get_num_ranks() > 1:
+            h5files = ["{0}/test_StatisticsComponent_hdf5_{1}.h5".format(outdir, rank)
+                       for rank in range(testing_check_get_num_ranks())]
+        for name in h5files:
+            self.assertTrue(os.path.exists(name), "HDF5 output file {0} was not written".format(name))
+
+        try:
+            import h5py
+        except ImportError:
+            return
+
+        # Every file has a row for every component in the group, and a
+        # shared file has the name of every component
+        for name in h5files:
+            with h5py.File(name, "r") as f:
+                self.assertEqual(len(f["collective/ids"]), 6, "{0} should list 6 components".format(name))
+                for stat in ["stat1_U32", "stat3_I32"]:
+                    self.assertEqual(f["collective/" + stat].shape[0], 6,
+                                     "{0} {1} should have a row per component".format(name, stat))
+                if len(h5files) == 1:
+                    names = sorted(n.decode() if isinstance(n, bytes) else n for n in f["collective/names"])
+                    self.assertEqual(names, ["IntComp{0}".format(i) for i in range(6)],
+                                     "{0} has the wrong component names".format(name))
+
 #####
 
-    def Statistics_test_template(self, testtype):
+    # Runs the statistics benchmark with the two statistic types and
+    # returns the CSV rows for stat_a and stat_b followed by the header
+    def benchmark_test_template(self, testtype, type_a, type_b, options=""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsBenchmark.py".format(testsuitedir)
+        outfile = "{0}/test_StatisticsBenchmark_{1}.out".format(outdir, testtype)
+        csvfile = "{0}/test_StatisticsBenchmark_{1}.csv".format(outdir, testtype)
+
+        self.run_sst(sdlfile, outfile, other_args="--model-options=\"{0} {1} {2} {3}\"".format(type_a, type_b, csvfile, options),
+                     num_ranks=1, num_threads=1)
+
+        with open(outfile, 'r') as f:
+            results = [line.strip() for line in f if line.startswith("stat_")]
+        for line in results:
+            log_info(line, forced=False)
+        self.assertEqual(len(results), 2, "Benchmark output {0} is missing results".format(outfile))
+
+        with open(csvfile, 'r') as f:
+            lines = [[x.strip() for x in line.split(",")] for line in f]
+        header = lines[0]
+        rows = sorted(lines[1:], key=lambda row: row[1])
+        self.assertEqual(len(rows), 2, "Benchmark statistics file {0} should have two rows".format(csvfile))
+        return rows + [header]
+
+    def Statistics_test_template(self, testtype, async_output=False):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
+        testname = testtype
+        options = ""
+        if async_output:
+            testname = "{0}_async".format(testtype)
+            options = "--async-stat-output --async-stat-output-queue=1024"
+
         sdlfile = "{0}/test_StatisticsComponent_{1}.py".format(testsuitedir, testtype)
         reffile = "{0}/refFiles/test_StatisticsComponent_{1}.out".format(testsuitedir, testtype)
-        outfile = "{0}/test_StatisticsComponent_{1}.out".format(outdir, testtype)
+        outfile = "{0}/test_StatisticsComponent_{1}.out".format(outdir, testname)
 
-        self.run_sst(sdlfile, outfile)
+        self.run_sst(sdlfile, outfile, other_args=options)
 
         # Perform the test
         filter1 = StartsWithFilter("WARNING: No components are")
@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_ThreadSync(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+
+    def test_ThreadSync_simple(self):
+        self.thread_sync_test_template("simple")
+
+    def test_ThreadSync_spsc(self):
+        self.thread_sync_test_template("spsc")
+
+    def test_ThreadSync_spsc_4threads(self):
+        self.thread_sync_test_template("spsc", num_threads=4)
+
+    def test_ThreadSync_benchmark(self):
+        self.benchmark_test_template()
+
+#####
+
+    def thread_sync_test_template(self, testtype, num_threads=2):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        testname = "{0}_{1}threads".format(testtype, num_threads)
+        outfile_ref = "{0}/test_ThreadSync_ref_{1}.out".format(outdir, testname)
+        outfile_check = "{0}/test_ThreadSync_check_{1}.out".format(outdir, testname)
+
+        ref_options = "--model-options=\"8 8\""
+        options = "--model-options=\"8 8\" --thread-sync={0}".format(testtype)
+
+        # The thread sync only changes how events get between threads,
+        # so the output has to match a serial run
+        self.run_sst(sdlfile, outfile_ref, other_args=ref_options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=options, num_ranks=1, num_threads=num_threads)
+
+        cmp_result = testing_compare_sorted_diff(testname, outfile_check, outfile_ref)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
+
+    def benchmark_test_template(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+
+        # Thread counts to benchmark.  To reproduce the full sweep use:
+        # 2 4 8 16 32 64 128 (with a mesh of at least "16 16")
+        thread_counts = [2, 4]
+        mesh = "8 8"
+
+        # Reports the barriers and average time per sync seen by
+        # thread 0, from the sync profiling tool
+        for testtype in ["simple", "spsc"]:
+            for num_threads in thread_counts:
+                testname = "{0}_{1}threads".format(testtype, num_threads)
+                outfile = "{0}/test_ThreadSync_benchmark_{1}.out".format(outdir, testname)
+                profile_file = "{0}/test_ThreadSync_benchmark_{1}_profile.out".format(outdir, testname)
+
+                options = "--model-options=\"{0}\" --thread-sync={1} ".format(mesh, testtype)
+                options += "--enable-profiling=\"sync:sst.profile.sync.time.steady(level=global)\" "
+                options += "--profiling-output={0}".format(profile_file)
+
+                self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=num_threads)
+
+                with open(profile_file, 'r') as f:
+                    lines = [line.strip() for line in f]
+                syncs = [line.split("=")[1].strip() for line in lines if line.startswith("SyncManager Count")]
+                times = [line.split("=")[1].strip() for line in lines if line.startswith("Average SyncManager Time")]
+                barriers = [line.split("=")[1].strip() for line in lines if line.startswith("Barrier Count")]
+                self.assertTrue(len(syncs) == num_threads and len(times) == num_threads and len(barriers) == num_threads,
+                                "Profile output {0} is missing sync results".format(profile_file))
+
+                log_info("ThreadSync benchmark {0}: {1} syncs, {2} barriers, {3}/sync".format(
+                    testname, syncs[0], barriers[0], times[0]), forced=False)
@@ -0,0 +1,150 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import time
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_TimeVortex(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_PerfComponent_priority_queue(self):
+        self.perf_component_test_template("priority_queue", "sst.timevortex.priority_queue")
+
+    def test_PerfComponent_binned_map(self):
+        self.perf_component_test_template("binned_map", "sst.timevortex.map.binned")
+
+    def test_PerfComponent_ladder_queue(self):
+        self.perf_component_test_template("ladder_queue", "sst.timevortex.ladder_queue")
+
+    def test_PerfComponent_packed_heap(self):
+        self.perf_component_test_template("packed_heap", "sst.timevortex.packed_heap")
+
+    def test_MessageMesh_binned_map(self):
+        self.message_mesh_test_template("binned_map", "sst.timevortex.map.binned")
+
+    def test_MessageMesh_ladder_queue(self):
+        self.message_mesh_test_template("ladder_queue", "sst.timevortex.ladder_queue")
+
+    def test_MessageMesh_packed_heap(self):
+        self.message_mesh_test_template("packed_heap", "sst.timevortex.packed_heap")
+
+    def test_Benchmark_priority_queue(self):
+        self.benchmark_test_template("priority_queue", "sst.timevortex.priority_queue")
+
+    def test_Benchmark_binned_map(self):
+        self.benchmark_test_template("binned_map", "sst.timevortex.map.binned")
+
+    def test_Benchmark_ladder_queue(self):
+        self.benchmark_test_template("ladder_queue", "sst.timevortex.ladder_queue")
+
+    def test_Benchmark_packed_heap(self):
+        self.benchmark_test_template("packed_heap", "sst.timevortex.packed_heap")
+
+#####
+
+    # Runs sst and reports the wall time so the TimeVortex
+    # implementations can be compared on the same workload
+    def timed_run_sst(self, testtype, sdlfile, outfile, other_args, **kwargs):
+        start = time.time()
+        self.run_sst(sdlfile, outfile, other_args=other_args, **kwargs)
+        elapsed = time.time() - start
+        log_info("TimeVortex benchmark {0}: {1:.3f} s".format(testtype, elapsed), forced=False)
+
+    def perf_component_test_template(self, testtype, timevortex):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--timeVortex={0}".format(timevortex)
+
+        sdlfile = "{0}/test_PerfComponent.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_PerfComponent.out".format(testsuitedir)
+        outfile = "{0}/test_TimeVortex_PerfComponent_{1}.out".format(outdir, testtype)
+
+        self.timed_run_sst("PerfComponent_" + testtype, sdlfile, outfile, options)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def message_mesh_test_template(self, testtype, timevortex):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        ref_options = "--model-options=\"8 8\" --timeVortex=sst.timevortex.priority_queue"
+        options = "--model-options=\"8 8\" --timeVortex={0}".format(timevortex)
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_ref = "{0}/test_TimeVortex_MessageMesh_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_TimeVortex_MessageMesh_check_{1}.out".format(outdir, testtype)
+
+        # The priority_queue is the reference ordering; a serial run
+        # with each implementation must match it exactly
+        self.timed_run_sst("MessageMesh_priority_queue", sdlfile, outfile_ref, ref_options, num_ranks=1, num_threads=1)
+        self.timed_run_sst("MessageMesh_" + testtype, sdlfile, outfile_check, options, num_ranks=1, num_threads=1)
+
+        cmp_result = testing_compare_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
+
+    def benchmark_test_template(self, testtype, timevortex):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sizes = [1000, 10000, 100000]
+        options = "--model-options=\"{0} {1}\"".format(timevortex, " ".join(str(x) for x in sizes))
+
+        sdlfile = "{0}/test_TimeVortexBenchmark.py".format(testsuitedir)
+        outfile = "{0}/test_TimeVortex_Benchmark_{1}.out".format(outdir, testtype)
+
+        # The benchmark checks the pop order itself and aborts on a
+        # violation, so all that is left is to make sure every depth
+        # reported its throughput
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=1)
+
+        with open(outfile, 'r') as f:
+            results = [line.strip() for line in f if line.startswith(timevortex + ": depth")]
+        for line in results:
+            log_info(line, forced=False)
+        self.assertEqual(len(results), len(sizes), "Benchmark output {0} is missing results".format(outfile))
@@ -12,6 +12,7 @@
 # distribution.
 
 import os
+import re
 import sys
 
 from sst_unittest import *
@@ -95,6 +96,50 @@ class testcase_Config_input_output(SSTTestCase):
         cmp_result = testing_compare_sorted_diff("check_single_parallel_load", outfile_ref, outfile_check)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
 
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_python_distributed_load(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+
+        outfile_ref = "{0}/test_configio_ref_distributed_load.out".format(outdir)
+        outfile_check = "{0}/test_configio_check_distributed_load.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile_ref, other_args="--model-options=\"6 6\"")
+        self.run_sst(sdlfile, outfile_check,
+                     other_args="--model-options=\"6 6\" --parallel-load=DISTRIBUTED --distributed-block-size=4")
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff("check_distributed_load", outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
+
+    def test_config_graph_memory(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_ConfigGraphMemory.py".format(testsuitedir)
+
+        # Build the graph with and without links so that the memory
+        # used by components and by links can be separated
+        usage = []
+        for links in [0, 1]:
+            outfile = "{0}/test_ConfigGraphMemory_{1}.out".format(outdir, links)
+            self.run_sst(sdlfile, outfile, other_args="-v --run-mode=init --model-options=\"20000 {0}\"".format(links),
+                         num_ranks=1, num_threads=1)
+            with open(outfile, 'r') as f:
+                match = re.search(r"Graph construction raised RSS by (\d+) KB for (\d+) components and (\d+) links",
+                                  f.read())
+            self.assertIsNotNone(match, "Output file {0} is missing the graph memory usage".format(outfile))
+            usage.append([int(x) for x in match.groups()])
+
+        self.assertEqual(usage[0][1:], [20000, 0], "Unexpected graph size: {0}".format(usage[0]))
+        self.assertEqual(usage[1][1:], [20000, 20000], "Unexpected graph size: {0}".format(usage[1]))
+        comp_bytes = usage[0][0] * 1024.0 / usage[0][1]
+        link_bytes = (usage[1][0] - usage[0][0]) * 1024.0 / usage[1][2]
+        log_info("Config graph memory: {0:.0f} bytes per component, {1:.0f} bytes per link".format(comp_bytes, link_bytes),
+                 forced=False)
+
 #####
 
     def configio_test_template(self, testtype, model_options, output_type, parallel_io, use_component_test=False):
@@ -63,9 +63,30 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_multilevel_profile(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Profile handler time per component and events per port, then
+        # partition using that profile
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile = "{0}/test_partitioner_profile_run.out".format(outdir)
+        profile_file = "{0}/test_partitioner_profile.txt".format(outdir)
+        options = ("--model-options=\"6 6\" "
+                   "--enable-profiling=\"event:sst.profile.handler.event.time.steady(level=subcomponent,track_ports=true);"
+                   "clock:sst.profile.handler.clock.time.steady(level=component)\" "
+                   "--profiling-output={0}".format(profile_file))
+        self.run_sst(sdlfile, outfile, other_args=options)
+
+        self.partitioner_test_template("multilevel_profile", "6 6", "sst.multilevel",
+                                       "--partitioner-profile={0}".format(profile_file))
+
 #####
 
-    def partitioner_test_template(self, testtype, model_options, partitioner):
+    def partitioner_test_template(self, testtype, model_options, partitioner, extra_args=""):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
@@ -78,7 +99,7 @@ class testcase_Partitioners(SSTTestCase):
 
         # Do a serial reference run
         self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
-        self.run_sst(sdlfile, outfile_check, other_args=options)
+        self.run_sst(sdlfile, outfile_check, other_args=options + " " + extra_args)
 
         # Perform the test
         cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)